@@ -1,11 +1,121 @@
 from flask import Flask, request, jsonify, render_template
+import threading
 import time
 import os
+import uuid
+
+from history import HistoryRing
+from storage import SegmentStore
 
 app = Flask(__name__, static_folder='static', template_folder='templates')
 latest_data = {"temp": 0, "humidity": 0, "light": 0, "update_time": 0}
-historical_data = []  # 保存历史数据
-MAX_HISTORY = 15  # 最多保留30条历史数据
+# 历史数据保留点数（每点20字节，默认100万点约20MB，1Hz采样约11.5天），可用环境变量调整
+HISTORY_CAPACITY = int(os.environ.get('PHYTOLINK_HISTORY_CAPACITY', 1000000))
+HISTORY_DEFAULT_POINTS = 30  # /get_history默认返回的点数（前端趋势图）
+HISTORY_MAX_POINTS = 10000  # 单次请求最多返回的点数
+history = HistoryRing(HISTORY_CAPACITY)  # 最近的历史数据（内存，供趋势图快速读取）
+# 持久化存储目录、数据保留天数（0为永久保留）、批量落盘间隔（秒，掉电最多丢失这段时间的数据）
+DATA_DIR = os.environ.get('PHYTOLINK_DATA_DIR', os.path.join(os.path.dirname(os.path.abspath(__file__)), 'data'))
+RETENTION_DAYS = float(os.environ.get('PHYTOLINK_RETENTION_DAYS', 0))
+FLUSH_INTERVAL = float(os.environ.get('PHYTOLINK_FLUSH_INTERVAL', 1.0))
+store = None  # 全部历史数据（磁盘），在open_store()中打开
+# 增量读取游标的前缀，每次启动不同（随机值，1秒内重启也不会重复）；
+# 客户端持有上次启动的游标时返回完整窗口让其重建
+SERVER_EPOCH = uuid.uuid4().hex
+DEDUP_WINDOW = 1024  # 每台设备去重窗口覆盖的序号数
+
+
+class SeqWindow:
+    """
+    滑动窗口位图去重（与IPsec/DTLS的防重放窗口相同）
+
+    只记录最大序号high和其之前DEDUP_WINDOW个序号是否已收到，
+    每台设备只占用一个整数位图，不需要逐条查询已存储的数据。
+    """
+
+    def __init__(self, boot):
+        self.boot = boot  # 设备的启动ID，设备重启后序号重新从1开始
+        self.high = 0  # 已收到的最大序号
+        self.bits = 0  # 第i位表示序号high-i是否已收到
+
+    def seen(self, seq):
+        """序号已收到或已滑出窗口返回True（只检查，不记录）"""
+        if seq > self.high:
+            return False
+        offset = self.high - seq
+        return offset >= DEDUP_WINDOW or bool(self.bits & (1 << offset))
+
+    def accept(self, seq):
+        """序号首次出现返回True，重复或已滑出窗口返回False"""
+        if seq > self.high:
+            shift = seq - self.high
+            self.bits = ((self.bits << shift) | 1) & ((1 << DEDUP_WINDOW) - 1)
+            self.high = seq
+            return True
+
+        offset = self.high - seq
+        if offset >= DEDUP_WINDOW:
+            return False  # 太旧，无法判断，按重复处理
+        if self.bits & (1 << offset):
+            return False
+        self.bits |= 1 << offset
+        return True
+
+
+dedup_windows = {}  # 设备ID -> SeqWindow
+dedup_lock = threading.Lock()
+dedup_stats = {"accepted": 0, "duplicates": 0}
+
+
+def save_record(t, temp, humi, light):
+    """更新最新数据并保存历史：磁盘追加（批量落盘），内存环形缓冲区写满后覆盖最旧数据"""
+    store.append(t, temp, humi, light)
+    history.append(t, temp, humi, light)
+    latest_data.update({
+        "temp"       : temp,
+        "humidity"   : humi,
+        "light"      : light,
+        "update_time": t
+    })
+
+
+def save_sequenced_record(dev, boot, seq, t, temp, humi, light):
+    """
+    保存带序号的记录(dev, boot, seq)，重复的记录不保存并返回False
+
+    保存成功后才把序号记为已收到：写入失败时设备会重发，重发的记录不能被当成重复。
+    检查、写入和记录在同一把锁内完成，同一序号的并发重发只会保存一次。
+    """
+    with dedup_lock:
+        window = dedup_windows.get(dev)
+        if window is None or window.boot != boot:
+            window = SeqWindow(boot)  # 新设备或设备已重启
+            dedup_windows[dev] = window
+        if window.seen(seq):
+            dedup_stats["duplicates"] += 1
+            return False
+        save_record(t, temp, humi, light)
+        window.accept(seq)
+        dedup_stats["accepted"] += 1
+        return True
+
+
+def open_store():
+    """打开持久化存储，并用最近的数据恢复内存历史和最新数据"""
+    global store
+    store = SegmentStore(DATA_DIR, flush_interval=FLUSH_INTERVAL, retention_seconds=RETENTION_DAYS * 86400)
+    start = time.perf_counter()
+    loaded = 0
+    last = None
+    for chunk in store.iter_tail(HISTORY_CAPACITY):  # 逐块装入，不构造全部记录的列表
+        history.extend(chunk)
+        loaded += len(chunk)
+        last = chunk[-1]
+    if last is not None:
+        t, temp, humi, light = last
+        latest_data.update({"temp": round(temp, 2), "humidity": round(humi, 2), "light": light, "update_time": t})
+    print("[store] %d records in %d segments, recovered in %.3f s (%d loaded into memory)" % (
+        len(store), len(store.segments), store.recovery_seconds + time.perf_counter() - start, loaded))
 
 
 # 注册模板函数（供前端模板使用，可选）
@@ -35,34 +145,95 @@ def receive_data():
         humi = float(request.args.get('humi', 0))
         light = int(request.args.get('light', 0))
         current_time = time.time()
+        cpu = request.args.get('cpu')  # 设备CPU负载（千分比），旧固件不带该参数
+        cpu = int(cpu) / 10.0 if cpu is not None else None
+        seq = request.args.get('seq')
+        if seq is not None:
+            seq = int(seq)
+            # 记录在设备端排队等待的时间，用于还原采样时刻
+            current_time -= int(request.args.get('age', 0)) / 1000.0
+    except ValueError as e:
+        # 请求本身有误，设备收到4xx后丢弃该记录
+        return f"Error: {str(e)}", 400
 
-        # 更新最新数据
-        latest_data.update({
-            "temp"       : temp,
-            "humidity"   : humi,
-            "light"      : light,
-            "update_time": current_time
-        })
-
-        # 保存历史数据（最多30条）
-        historical_data.append({
-            "time"    : current_time,
-            "temp"    : temp,
-            "humidity": humi,
-            "light"   : light
-        })
-        if len(historical_data) > MAX_HISTORY:
-            historical_data.pop(0)  # 移除最旧数据
-
+    try:
+        if cpu is not None:
+            latest_data["cpu_load"] = cpu
+        # 带序号的记录去重；重复提交也返回OK，设备据此将记录出队
+        if seq is not None:
+            if not save_sequenced_record(request.args.get('dev', ''), request.args.get('boot', ''), seq,
+                                         current_time, temp, humi, light):
+                return "OK DUP", 200
+        else:
+            save_record(current_time, temp, humi, light)
         return "OK", 200
     except Exception as e:
-        return f"Error: {str(e)}", 400
+        # 服务器端保存失败，返回5xx让设备保留记录稍后重发
+        return f"Error: {str(e)}", 500
 
 
 # 历史数据接口（供前端获取）
+# 参数：n为返回最近的点数（默认30）；或start/end为时间范围（Unix时间戳），
+# 两种方式返回的点数都不超过HISTORY_MAX_POINTS（时间范围内取最近的点）；
+# 时间范围早于内存中最旧的数据时从磁盘读取；
+# 带since参数时只返回游标之后的新数据，见get_history_since()
 @app.route('/get_history', methods=['GET'])
 def get_history():
-    return jsonify(historical_data)
+    try:
+        n = min(int(request.args.get('n', HISTORY_DEFAULT_POINTS)), HISTORY_MAX_POINTS)
+        since = request.args.get('since')
+        if since is not None:
+            return get_history_since(since, n)
+        start = request.args.get('start')
+        end = request.args.get('end')
+        if start is not None or end is not None:
+            start = float(start or 0)
+            end = float(end or 'inf')
+        with history.lock:
+            if start is None:
+                return jsonify(HistoryRing.records(history.last(n)))
+            if len(history) and history.oldest_time() <= start:
+                lo, hi = history.index_range(start, end)
+                return jsonify(HistoryRing.records(history.slice(max(lo, hi - HISTORY_MAX_POINTS), hi)))
+        rows = store.query(start, end, HISTORY_MAX_POINTS)
+        return jsonify([{"time": t, "temp": round(temp, 2), "humidity": round(humi, 2), "light": light}
+                        for t, temp, humi, light in rows])
+    except ValueError as e:
+        return f"Error: {str(e)}", 400
+
+
+def get_history_since(since, n):
+    """
+    增量读取：返回{"cursor": 新游标, "reset": 是否为完整窗口, "points": 数据点}
+
+    游标格式为"启动标识:累计点数"，同时用作ETag。
+    请求带If-None-Match且与当前游标相同（没有新数据）时返回304，不生成响应体；
+    since为空、来自上次启动、或游标之后的新数据已超过n个点（客户端只保留n个点）时，
+    返回最近n个点并置reset，客户端应丢弃已有数据。
+    """
+    with history.lock:
+        cursor = '%s:%d' % (SERVER_EPOCH, history.total)
+        if request.if_none_match.contains(cursor):
+            response = app.response_class(status=304)
+        else:
+            epoch, _, seq = since.partition(':')
+            segments = None
+            if epoch == SERVER_EPOCH and seq.isdigit() and history.total - int(seq) <= n:
+                segments = history.after(int(seq))
+            reset = segments is None
+            if reset:
+                segments = history.last(n)
+            response = jsonify({"cursor": cursor, "reset": reset, "points": HistoryRing.records(segments)})
+    response.set_etag(cursor)
+    response.headers['Cache-Control'] = 'no-cache'
+    return response
+
+
+# 去重统计接口
+@app.route('/get_dedup_stats', methods=['GET'])
+def get_dedup_stats():
+    with dedup_lock:
+        return jsonify(dict(dedup_stats, devices=len(dedup_windows)))
 
 
 # 实时数据接口（供前端获取）
@@ -83,6 +254,10 @@ def index():
     return render_template('index.html')
 
 
+# 调试模式的重载器父进程只监视文件、不处理请求，不打开存储（存储目录同一时刻只允许一个进程写入）
+if __name__ != '__main__' or os.environ.get('WERKZEUG_RUN_MAIN') == 'true':
+    open_store()
+
 if __name__ == '__main__':
     # 创建静态目录和模板目录
     for dir_name in ['static', 'templates']:
@@ -0,0 +1,92 @@
+"""
+历史数据存储的微基准：对比环形缓冲区与原来的list+pop(0)
+
+对每个规模N测量：
+  fill     填满N个点的平均追加耗时
+  append   缓冲区已满（每次覆盖最旧数据）时的平均追加耗时
+  last30   取最近30个点的切片（只建视图）
+  last30+  取最近30个点并转换为字典列表（/get_history默认请求的实际开销）
+  range1%  按时间二分查找并切出1%的点（只建视图）
+  full     切出全部N个点（只建视图，零拷贝，与N无关）
+list+pop(0)基线在N较大时内存和耗时不可接受，只测到--baseline-max。
+
+用法：
+  python bench_history.py                       # N = 10^3, 10^5, 10^7（10^7约需200MB内存）
+  python bench_history.py --sizes 1000 100000
+"""
+
+import argparse
+import time
+
+from history import HistoryRing
+
+
+def per_op(func, repeat):
+    """执行func repeat次，返回每次的平均耗时（微秒）"""
+    start = time.perf_counter()
+    for _ in range(repeat):
+        func()
+    return (time.perf_counter() - start) / repeat * 1e6
+
+
+def bench_ring(n, steady_ops):
+    ring = HistoryRing(n)
+    append = ring.append
+
+    start = time.perf_counter()
+    for i in range(n):
+        append(float(i), 25.0, 60.0, 100)
+    fill_us = (time.perf_counter() - start) / n * 1e6
+
+    start = time.perf_counter()
+    for i in range(n, n + steady_ops):
+        append(float(i), 25.0, 60.0, 100)
+    append_us = (time.perf_counter() - start) / steady_ops * 1e6
+
+    # 追加steady_ops个点后，时间范围为[steady_ops, n + steady_ops)
+    lo = steady_ops + n // 2
+    hi = lo + max(1, n // 100)
+    return {
+        "fill": fill_us,
+        "append": append_us,
+        "last30": per_op(lambda: ring.last(30), 10000),
+        "last30+": per_op(lambda: HistoryRing.records(ring.last(30)), 10000),
+        "range1%": per_op(lambda: ring.between(lo, hi), 10000),
+        "full": per_op(lambda: ring.slice(0, n), 10000),
+    }
+
+
+def bench_list(n, steady_ops):
+    data = []
+
+    def append(t):
+        data.append({"time": t, "temp": 25.0, "humidity": 60.0, "light": 100})
+        if len(data) > n:
+            data.pop(0)
+
+    for i in range(n):
+        append(float(i))
+    start = time.perf_counter()
+    for i in range(n, n + steady_ops):
+        append(float(i))
+    return (time.perf_counter() - start) / steady_ops * 1e6
+
+
+def main():
+    parser = argparse.ArgumentParser(description="History store micro-benchmark")
+    parser.add_argument("--sizes", type=int, nargs="+", default=[10 ** 3, 10 ** 5, 10 ** 7])
+    parser.add_argument("--steady", type=int, default=100000, help="appends measured after the buffer is full")
+    parser.add_argument("--baseline-max", type=int, default=10 ** 5, help="largest N for the list+pop(0) baseline")
+    args = parser.parse_args()
+
+    cols = ("fill", "append", "last30", "last30+", "range1%", "full")
+    print("%10s " % "N" + " ".join("%9s" % c for c in cols) + " %12s" % "list append")
+    print("%10s " % "" + " ".join("%9s" % "us/op" for _ in cols) + " %12s" % "us/op")
+    for n in args.sizes:
+        r = bench_ring(n, args.steady)
+        base = "%12.3f" % bench_list(n, min(args.steady, 10000)) if n <= args.baseline_max else "%12s" % "skipped"
+        print("%10d " % n + " ".join("%9.3f" % r[c] for c in cols) + " " + base)
+
+
+if __name__ == "__main__":
+    main()
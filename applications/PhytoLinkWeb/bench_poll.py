@@ -0,0 +1,73 @@
+"""
+前端轮询历史数据的开销：全量/get_history与since增量读取对比
+
+模拟一个浏览器客户端每秒轮询一次，统计折算到每个客户端每分钟的
+传输字节数（状态行+响应头+响应体）和服务器处理请求的CPU时间：
+  full         原来的做法：每秒取回完整的30个点
+  since 1Hz    增量读取，设备每秒上传一个点（每次轮询取回1个新点）
+  since idle   增量读取，设备离线（每次轮询都是304）
+  framework    同样频率请求/get_dedup_stats（极小的JSON），作为Flask和测试客户端本身的开销
+只统计轮询请求本身，上传请求的开销不计入。
+
+用法（需要安装Flask，数据写在临时目录）：
+  python bench_poll.py
+  python bench_poll.py --minutes 10
+"""
+
+import argparse
+import os
+import tempfile
+import time
+
+os.environ.setdefault("PHYTOLINK_DATA_DIR", tempfile.mkdtemp(prefix="phytolink-poll-"))
+
+from app import app  # noqa: E402  导入时会打开上面的临时存储
+
+
+def wire_bytes(response):
+    """响应在HTTP/1.1连接上的大致字节数"""
+    head = len("HTTP/1.1 %s\r\n" % response.status) + 2
+    head += sum(len(k) + len(v) + 4 for k, v in response.headers.items())
+    return head + len(response.get_data())
+
+
+def run(client, minutes, upload, incremental, path="/get_history"):
+    bytes_total = 0
+    cpu = 0.0
+    cursor = ""
+    for _ in range(minutes * 60):
+        if upload:
+            client.get("/upload?temp=25.3&humi=61.2&light=820")
+        start = time.process_time()
+        if incremental:
+            headers = {"If-None-Match": '"%s"' % cursor} if cursor else {}
+            response = client.get("/get_history?n=30&since=" + cursor, headers=headers)
+            if response.status_code == 200:
+                cursor = response.get_json()["cursor"]
+        else:
+            response = client.get(path)
+        cpu += time.process_time() - start
+        bytes_total += wire_bytes(response)
+    return bytes_total / minutes, cpu / minutes * 1e3
+
+
+def main():
+    parser = argparse.ArgumentParser(description="History polling cost per client")
+    parser.add_argument("--minutes", type=int, default=5)
+    args = parser.parse_args()
+
+    client = app.test_client()
+    for _ in range(30):  # 先填满一个图表窗口
+        client.get("/upload?temp=25.3&humi=61.2&light=820")
+
+    print("%-12s %14s %16s" % ("", "bytes/min", "server CPU ms/min"))
+    for label, upload, incremental, path in (("full", True, False, "/get_history"),
+                                             ("since 1Hz", True, True, None),
+                                             ("since idle", False, True, None),
+                                             ("framework", False, False, "/get_dedup_stats")):
+        per_min, cpu_ms = run(client, args.minutes, upload, incremental, path)
+        print("%-12s %14.0f %16.2f" % (label, per_min, cpu_ms))
+
+
+if __name__ == "__main__":
+    main()
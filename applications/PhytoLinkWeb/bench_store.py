@@ -0,0 +1,87 @@
+"""
+持久化存储的基准测试：写入速率、范围查询延迟、重启恢复时间
+
+步骤：
+  ingest    以1Hz的时间戳连续写入--days天的数据（后台线程批量fsync），统计持续写入速率
+  query     在全部数据中随机查询1分钟/1小时/1天的时间范围（最多返回--limit条）
+  recover   模拟掉电：在当前分区末尾追加半条记录、在索引末尾追加半个索引项，
+            然后重新打开存储并把最近--warm条记录逐块装入HistoryRing（app.py启动时恢复内存历史的做法）
+
+用法：
+  python bench_store.py                    # 7天数据（约60万条），数据写在临时目录
+  python bench_store.py --days 30 --dir /data/bench
+"""
+
+import argparse
+import os
+import random
+import shutil
+import tempfile
+import time
+
+from history import HistoryRing
+from storage import SegmentStore
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Segment store benchmark")
+    parser.add_argument("--days", type=float, default=7, help="days of 1 Hz data to ingest")
+    parser.add_argument("--dir", help="data directory (default: a temporary directory)")
+    parser.add_argument("--queries", type=int, default=200, help="queries per range size")
+    parser.add_argument("--limit", type=int, default=10000, help="max records per query (as /get_history)")
+    parser.add_argument("--warm", type=int, default=1000000, help="records loaded after reopening")
+    args = parser.parse_args()
+
+    root = args.dir or tempfile.mkdtemp(prefix="phytolink-store-")
+    shutil.rmtree(root, ignore_errors=True)
+    n = int(args.days * 86400)
+    t0 = 1760745600.0  # 分区边界对齐的起始时间
+
+    store = SegmentStore(root)
+    start = time.perf_counter()
+    for i in range(n):
+        store.append(t0 + i, 20.0 + i % 100 * 0.1, 50.0 + i % 50 * 0.5, i % 15000)
+    store.flush()
+    ingest = time.perf_counter() - start
+    size = sum(os.path.getsize(os.path.join(root, f)) for f in os.listdir(root))
+    print("ingest   %d records in %.2f s: %.0f records/s, %d segments, %.1f MB on disk"
+          % (n, ingest, n / ingest, len(store.segments), size / 1e6))
+
+    for label, span in (("1 min", 60), ("1 hour", 3600), ("1 day", 86400)):
+        span = min(span, n)
+        lat = []
+        rows = 0
+        for _ in range(args.queries):
+            a = t0 + random.randrange(0, n - span + 1)
+            q = time.perf_counter()
+            rows += len(store.query(a, a + span - 1, args.limit))
+            lat.append(time.perf_counter() - q)
+        lat.sort()
+        print("query    %-6s  %5d rows  p50 %7.2f ms  p99 %7.2f ms"
+              % (label, rows // args.queries, lat[len(lat) // 2] * 1e3, lat[int(len(lat) * 0.99)] * 1e3))
+    store.close()
+
+    seg = sorted(f for f in os.listdir(root) if f.endswith(".seg"))[-1]
+    with open(os.path.join(root, seg), "ab") as f:
+        f.write(b"\x00" * 7)  # 写了一半的记录
+    with open(os.path.join(root, seg[:-4] + ".idx"), "ab") as f:
+        f.write(b"\x00" * 5)  # 写了一半的索引项
+
+    start = time.perf_counter()
+    store = SegmentStore(root)
+    opened = time.perf_counter() - start
+    recent = HistoryRing(args.warm)
+    for chunk in store.iter_tail(args.warm):
+        recent.extend(chunk)
+    total = time.perf_counter() - start
+    assert len(store) == n and recent.time[recent.head - 1] == t0 + n - 1, "recovery lost data"
+    print("recover  open %.1f ms (%d segments), open + load %d recent records %.2f s"
+          % (opened * 1e3, len(store.segments), len(recent), total))
+    store.close()
+
+    if not args.dir:
+        shutil.rmtree(root)
+
+
+if __name__ == "__main__":
+    main()
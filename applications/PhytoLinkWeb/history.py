@@ -0,0 +1,134 @@
+import threading
+from array import array
+from bisect import bisect_left, bisect_right
+
+# 列名及存储类型：时间用双精度，温湿度用单精度，光照用32位整数，每个点共20字节
+COLUMNS = (("time", "d"), ("temp", "f"), ("humidity", "f"), ("light", "i"))
+
+
+class _TimeAxis:
+    """按逻辑下标（0为最旧）访问时间列，供bisect在环形缓冲区上二分查找"""
+
+    def __init__(self, ring):
+        self.ring = ring
+        self.base = ring.head - ring.count  # 最旧点的物理下标（可能为负，取模后有效）
+
+    def __len__(self):
+        return self.ring.count
+
+    def __getitem__(self, i):
+        return self.ring.time[(self.base + i) % self.ring.capacity]
+
+
+class HistoryRing:
+    """
+    预分配的列式环形缓冲区
+
+    每列一个定长array，写满后覆盖最旧的数据，追加为O(1)。
+    切片返回memoryview，不复制数据；跨越缓冲区末尾的区间分成两段返回。
+    按时间查询时二分查找时间列，假定数据大致按时间顺序到达
+    （设备按序号顺序补传积压记录，满足这一条件）。
+    """
+
+    def __init__(self, capacity):
+        if capacity <= 0:
+            raise ValueError("capacity must be positive")
+        self.capacity = capacity
+        for name, code in COLUMNS:
+            setattr(self, name, array(code, bytes(array(code).itemsize * capacity)))
+        self.views = {name: memoryview(getattr(self, name)) for name, _ in COLUMNS}
+        self.head = 0  # 下一个写入位置
+        self.count = 0  # 有效数据点数
+        self.total = 0  # 累计追加的点数，用作增量读取的游标
+        self.lock = threading.Lock()
+
+    def __len__(self):
+        return self.count
+
+    def append(self, t, temp, humidity, light):
+        """追加一个数据点，缓冲区满时覆盖最旧的点"""
+        with self.lock:
+            i = self.head
+            self.time[i] = t
+            self.temp[i] = temp
+            self.humidity[i] = humidity
+            self.light[i] = light
+            self.head = i + 1 if i + 1 < self.capacity else 0
+            if self.count < self.capacity:
+                self.count += 1
+            self.total += 1
+
+    def extend(self, rows):
+        """
+        批量追加(时间, 温度, 湿度, 光照)序列，按列整段写入缓冲区
+
+        用于启动时从存储恢复；结果与逐个append相同，只保留最后capacity个点。
+        """
+        n = len(rows)
+        if n == 0:
+            return
+        columns = list(zip(*rows))
+        with self.lock:
+            pos = max(0, n - self.capacity)  # 会被覆盖的点不必写入，只推进写入位置
+            self.head = (self.head + pos) % self.capacity
+            while pos < n:
+                i = self.head
+                k = min(n - pos, self.capacity - i)
+                for (name, code), values in zip(COLUMNS, columns):
+                    getattr(self, name)[i:i + k] = array(code, values[pos:pos + k])
+                self.head = i + k if i + k < self.capacity else 0
+                pos += k
+            self.count = min(self.capacity, self.count + n)
+            self.total += n
+
+    def slice(self, start, stop):
+        """
+        按逻辑下标[start, stop)切片（0为最旧），返回1~2段，每段为{列名: memoryview}
+
+        返回的视图直接指向缓冲区，之后的追加可能覆盖其中的数据，
+        需要稳定副本时在持有lock期间调用records()。
+        """
+        start = max(0, start)
+        stop = min(self.count, stop)
+        if stop <= start:
+            return []
+        a = (self.head - self.count + start) % self.capacity
+        n = stop - start
+        first = min(n, self.capacity - a)
+        bounds = [(a, a + first)]
+        if n > first:
+            bounds.append((0, n - first))  # 跨越缓冲区末尾
+        return [{name: view[s:e] for name, view in self.views.items()} for s, e in bounds]
+
+    def last(self, n):
+        """最近n个点"""
+        return self.slice(self.count - n, self.count)
+
+    def after(self, seq):
+        """游标seq（当时的total）之后追加的点；这些点已被覆盖或seq无效时返回None"""
+        first = self.total - self.count
+        if seq < first or seq > self.total:
+            return None
+        return self.slice(seq - first, self.count)
+
+    def oldest_time(self):
+        """最旧点的时间（缓冲区不能为空）"""
+        return self.time[(self.head - self.count) % self.capacity]
+
+    def index_range(self, start_time, end_time):
+        """时间在[start_time, end_time]内的点的逻辑下标范围[lo, hi)"""
+        axis = _TimeAxis(self)
+        return bisect_left(axis, start_time), bisect_right(axis, end_time)
+
+    def between(self, start_time, end_time):
+        """时间在[start_time, end_time]内的点"""
+        return self.slice(*self.index_range(start_time, end_time))
+
+    @staticmethod
+    def records(segments):
+        """把切片转换为字典列表（用于JSON输出），温湿度保留两位小数"""
+        out = []
+        for seg in segments:
+            for t, temp, humi, light in zip(seg["time"], seg["temp"], seg["humidity"], seg["light"]):
+                out.append({"time": t, "temp": round(temp, 2), "humidity": round(humi, 2), "light": light})
+        return out
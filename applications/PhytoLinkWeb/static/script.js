@@ -193,9 +193,18 @@ const detailChart = new Chart(detailCtx, {
 /**
  * 全局变量
  */
+const HISTORY_WINDOW = 30; // 图表显示的点数
 const historicalData = [];
+let historyCursor = ''; // 增量读取历史数据的游标（服务器返回）
 let currentDetailMetric = 'temp'; // 当前详细图表显示的指标
 
+// 详细图表各指标的参数（pad为Y轴在数据范围上下留出的余量）
+const DETAIL_METRICS = {
+    temp:  { key: 'temp',     label: '温度 (°C)',  color: '#ff6b6b', pad: 5 },
+    humi:  { key: 'humidity', label: '湿度 (%)',   color: '#4ecdc4', pad: 5 },
+    light: { key: 'light',    label: '光照 (lux)', color: '#ffe66d', pad: 500 }
+};
+
 /**
  * 更新状态显示
  */
@@ -280,6 +289,14 @@ function getGaugePercent(value, type) {
     return Math.min(100, Math.max(0, percent)).toFixed(1);
 }
 
+/**
+ * 时间戳转换为时分秒标签
+ */
+function timeLabel(time) {
+    const d = new Date(time * 1000);
+    return `${d.getHours().toString().padStart(2, '0')}:${d.getMinutes().toString().padStart(2, '0')}:${d.getSeconds().toString().padStart(2, '0')}`;
+}
+
 /**
  * 更新趋势图表
  */
@@ -287,10 +304,7 @@ function updateTrendChart() {
     if (historicalData.length === 0) return;
     
     // 修改：显示时分秒格式
-    trendChart.data.labels = historicalData.map(item => {
-        const d = new Date(item.time * 1000);
-        return `${d.getHours().toString().padStart(2, '0')}:${d.getMinutes().toString().padStart(2, '0')}:${d.getSeconds().toString().padStart(2, '0')}`;
-    });
+    trendChart.data.labels = historicalData.map(item => timeLabel(item.time));
     
     trendChart.data.datasets[0].data = historicalData.map(item => item.temp);
     trendChart.data.datasets[1].data = historicalData.map(item => item.humidity);
@@ -299,57 +313,61 @@ function updateTrendChart() {
     trendChart.update();
 }
 
+/**
+ * 根据当前数据设置详细图表的Y轴范围
+ */
+function updateDetailRange() {
+    const { key, pad } = DETAIL_METRICS[currentDetailMetric];
+    const values = historicalData.map(item => item[key]);
+    
+    detailChart.options.scales.y.min = Math.max(0, Math.min(...values) - pad); // 确保最小值不小于0
+    detailChart.options.scales.y.max = Math.max(...values) + pad;
+}
+
 /**
  * 更新详细图表
  */
 function updateDetailChart() {
     if (historicalData.length === 0) return;
     
-    let dataKey, label, color, min, max;
-    
-    // 根据当前选择的指标设置图表参数
-    switch(currentDetailMetric) {
-        case 'temp':
-            dataKey = 'temp';
-            label = '温度 (°C)';
-            color = '#ff6b6b';
-            min = Math.min(...historicalData.map(item => item.temp)) - 5;
-            max = Math.max(...historicalData.map(item => item.temp)) + 5;
-            break;
-        case 'humi':
-            dataKey = 'humidity';
-            label = '湿度 (%)';
-            color = '#4ecdc4';
-            min = Math.min(...historicalData.map(item => item.humidity)) - 5;
-            max = Math.max(...historicalData.map(item => item.humidity)) + 5;
-            break;
-        case 'light':
-            dataKey = 'light';
-            label = '光照 (lux)';
-            color = '#ffe66d';
-            min = Math.min(...historicalData.map(item => item.light)) - 500;
-            max = Math.max(...historicalData.map(item => item.light)) + 500;
-            break;
-    }
+    const { key, label, color } = DETAIL_METRICS[currentDetailMetric];
     
     // 设置Y轴动态范围
-    detailChart.options.scales.y.min = Math.max(0, min); // 确保最小值不小于0
-    detailChart.options.scales.y.max = max;
+    updateDetailRange();
     
     // 修改：显示时分秒格式
-    detailChart.data.labels = historicalData.map(item => {
-        const d = new Date(item.time * 1000);
-        return `${d.getHours().toString().padStart(2, '0')}:${d.getMinutes().toString().padStart(2, '0')}:${d.getSeconds().toString().padStart(2, '0')}`;
-    });
+    detailChart.data.labels = historicalData.map(item => timeLabel(item.time));
     
     detailChart.data.datasets[0].label = label;
-    detailChart.data.datasets[0].data = historicalData.map(item => item[dataKey]);
+    detailChart.data.datasets[0].data = historicalData.map(item => item[key]);
     detailChart.data.datasets[0].borderColor = color;
     detailChart.data.datasets[0].backgroundColor = `${color}33`; // 带透明度的背景色
     
     detailChart.update();
 }
 
+/**
+ * 向两个图表追加新数据点，并移除滑出窗口的旧点（不重建图表数据）
+ */
+function appendCharts(points, dropped) {
+    const { key } = DETAIL_METRICS[currentDetailMetric];
+    
+    for (const chart of [trendChart, detailChart]) {
+        chart.data.labels.splice(0, dropped);
+        chart.data.datasets.forEach(ds => ds.data.splice(0, dropped));
+        chart.data.labels.push(...points.map(item => timeLabel(item.time)));
+    }
+    
+    trendChart.data.datasets[0].data.push(...points.map(item => item.temp));
+    trendChart.data.datasets[1].data.push(...points.map(item => item.humidity));
+    trendChart.data.datasets[2].data.push(...points.map(item => item.light));
+    detailChart.data.datasets[0].data.push(...points.map(item => item[key]));
+    updateDetailRange();
+    
+    trendChart.update();
+    detailChart.update();
+}
+
 /**
  * 数值变化动画
  */
@@ -379,16 +397,27 @@ function animateValue(elementId, targetValue, decimalPlaces) {
 }
 
 /**
- * 获取历史数据
+ * 获取历史数据（增量）
+ *
+ * 只请求游标之后的新数据；没有新数据时服务器返回304（无响应体）。
+ * 服务器返回reset时（首次加载、服务器重启、离线太久）用返回的完整窗口重建图表。
  */
 async function fetchHistory() {
     try {
-        const res = await fetch('/get_history');
+        const headers = historyCursor ? { 'If-None-Match': `"${historyCursor}"` } : {};
+        const res = await fetch(`/get_history?n=${HISTORY_WINDOW}&since=${encodeURIComponent(historyCursor)}`,
+                                { headers, cache: 'no-store' });
+        if (res.status === 304) return; // 没有新数据
         if (!res.ok) throw new Error(`HTTP错误：${res.status}`);
         
-        const data = await res.json();
-        historicalData.length = 0;
-        historicalData.push(...data);
+        const { cursor, reset, points } = await res.json();
+        historyCursor = cursor;
+        if (!reset && points.length === 0) return;
+        
+        if (reset) historicalData.length = 0;
+        historicalData.push(...points);
+        const dropped = Math.max(0, historicalData.length - HISTORY_WINDOW);
+        historicalData.splice(0, dropped);
         
         if (historicalData.length > 0) {
             const latest = historicalData[historicalData.length - 1];
@@ -400,8 +429,12 @@ async function fetchHistory() {
             updateProgressBars(latest);
             updateStatus();
             
-            updateTrendChart();
-            updateDetailChart();
+            if (reset) {
+                updateTrendChart();
+                updateDetailChart();
+            } else {
+                appendCharts(points, dropped);
+            }
             
             document.getElementById('chart-loading').style.display = 'none';
             document.getElementById('trendChart').style.display = 'block';
@@ -0,0 +1,328 @@
+import atexit
+import os
+import struct
+import threading
+import time
+
+try:
+    import fcntl
+except ImportError:  # Windows没有fcntl，不做跨进程互斥
+    fcntl = None
+
+# 段文件格式：20字节文件头 + 定长记录，只追加不修改
+#   文件头：魔数、版本、记录长度、每块记录数、段起始时间
+#   记录：时间(double)、温度(float)、湿度(float)、光照(int32)，小端，共20字节
+# 索引文件（同名.idx）：每满一块（block_records条记录）追加一项(块内最小时间, 块内最大时间)，
+#   块i对应记录[i*block_records, (i+1)*block_records)，偏移量由块号直接算出，不需要存储
+MAGIC = b"PLTS"
+VERSION = 1
+HEADER = struct.Struct("<4sHHIq")
+RECORD = struct.Struct("<dffi")
+BLOCK = struct.Struct("<dd")
+
+
+class _Segment:
+    """一个时间分区：数据文件 + 稀疏时间索引"""
+
+    def __init__(self, path, start, block_records):
+        self.path = path
+        self.idx_path = path[:-4] + ".idx"
+        self.start = start  # 分区起始时间（按分区长度对齐）
+        self.block_records = block_records
+        self.count = 0  # 记录数
+        self.blocks = []  # 已写满的块的(最小时间, 最大时间)
+        self.tail_min = float("inf")  # 未写满的尾块的时间范围
+        self.tail_max = float("-inf")
+        self.min_time = float("inf")  # 整个分区的时间范围，用于查询时跳过分区
+        self.max_time = float("-inf")
+        self.expired = False  # 已超过保留期被删除（快照中可能还有读者）
+
+    def create(self):
+        with open(self.path, "wb") as f:
+            f.write(HEADER.pack(MAGIC, VERSION, RECORD.size, self.block_records, self.start))
+        open(self.idx_path, "wb").close()
+
+    def load(self):
+        """
+        打开已有的分区（重启恢复）
+
+        截掉掉电时写了一半的记录和索引项；索引只覆盖已写满的块，
+        之后的记录（通常不足几块）从数据文件读出后补齐索引，不需要扫描整个分区。
+        """
+        with open(self.path, "rb") as f:
+            magic, version, rsize, block_records, start = HEADER.unpack(f.read(HEADER.size))
+        if magic != MAGIC or version != VERSION or rsize != RECORD.size:
+            raise ValueError("%s: unsupported segment format" % self.path)
+        self.block_records = block_records
+
+        size = os.path.getsize(self.path)
+        self.count = (size - HEADER.size) // RECORD.size
+        if HEADER.size + self.count * RECORD.size != size:
+            os.truncate(self.path, HEADER.size + self.count * RECORD.size)
+
+        full = self.count // block_records
+        idx_size = os.path.getsize(self.idx_path) if os.path.exists(self.idx_path) else 0
+        keep = min(full, idx_size // BLOCK.size)
+        with open(self.idx_path, "ab+") as f:
+            f.seek(0)
+            data = f.read(keep * BLOCK.size)
+            if idx_size != len(data):
+                f.truncate(len(data))
+        self.blocks = list(BLOCK.iter_unpack(data))
+
+        # 索引之后的记录：补齐已写满的块的索引项，剩余部分作为尾块
+        first = len(self.blocks) * block_records
+        missing = []
+        lo, hi = float("inf"), float("-inf")
+        for i, rec in enumerate(self.read(first, self.count), first):
+            lo, hi = min(lo, rec[0]), max(hi, rec[0])
+            if (i + 1) % block_records == 0:
+                missing.append((lo, hi))
+                lo, hi = float("inf"), float("-inf")
+        if missing:
+            with open(self.idx_path, "ab") as f:
+                f.write(b"".join(BLOCK.pack(*b) for b in missing))
+            self.blocks.extend(missing)
+        self.tail_min, self.tail_max = lo, hi
+
+        for lo, hi in self.blocks + [(self.tail_min, self.tail_max)]:
+            self.min_time = min(self.min_time, lo)
+            self.max_time = max(self.max_time, hi)
+
+    def add(self, t):
+        """登记一条新记录的时间，尾块写满时返回其索引项"""
+        self.count += 1
+        self.tail_min = min(self.tail_min, t)
+        self.tail_max = max(self.tail_max, t)
+        self.min_time = min(self.min_time, t)
+        self.max_time = max(self.max_time, t)
+        if self.count % self.block_records:
+            return None
+        block = (self.tail_min, self.tail_max)
+        self.blocks.append(block)
+        self.tail_min, self.tail_max = float("inf"), float("-inf")
+        return block
+
+    def read(self, first, stop):
+        """
+        读出记录[first, stop)，返回(时间, 温度, 湿度, 光照)列表
+
+        查询在锁外读文件，期间分区可能到期被删除：已打开的文件仍可读完，
+        打开时文件已删除则按空分区处理（这些记录本来就已过期）。
+        """
+        if stop <= first:
+            return []
+        try:
+            f = open(self.path, "rb")
+        except FileNotFoundError:
+            if self.expired:
+                return []
+            raise
+        with f:
+            f.seek(HEADER.size + first * RECORD.size)
+            return list(RECORD.iter_unpack(f.read((stop - first) * RECORD.size)))
+
+    def candidate_runs(self, start_time, end_time, count):
+        """时间范围与查询重叠的块，合并成连续的记录区间[first, stop)，用于减少读文件次数"""
+        n = self.block_records
+        ranges = [(i * n, (i + 1) * n) for i, (lo, hi) in enumerate(self.blocks)
+                  if lo <= end_time and hi >= start_time]
+        if count > len(self.blocks) * n and self.tail_min <= end_time and self.tail_max >= start_time:
+            ranges.append((len(self.blocks) * n, count))
+        runs = []
+        for first, stop in ranges:
+            if runs and runs[-1][1] == first:
+                runs[-1] = (runs[-1][0], stop)
+            else:
+                runs.append((first, stop))
+        return runs
+
+
+class SegmentStore:
+    """
+    按时间分区、只追加的时间序列存储
+
+    每个分区（默认一天）一个数据文件和一个稀疏索引文件，索引每block_records条记录一项，
+    范围查询先按分区、再按块的时间范围跳过无关数据，只读取可能命中的块。
+    append()只写内存缓冲，后台线程每flush_interval秒（或攒够flush_records条）
+    批量写入并fsync一次，掉电最多丢失最近flush_interval秒的数据。
+    分区按记录到达时所在的时间划分；补传的旧记录写入当前分区，
+    块和分区都记录实际的最小/最大时间，因此查询结果不受影响。
+    """
+
+    def __init__(self, root, segment_seconds=86400, block_records=256,
+                 flush_interval=1.0, flush_records=4096, retention_seconds=0):
+        self.root = root
+        self.segment_seconds = segment_seconds
+        self.block_records = block_records
+        self.flush_interval = flush_interval
+        self.flush_records = flush_records
+        self.retention_seconds = retention_seconds  # 0表示永久保留
+        self.lock = threading.Lock()
+        self.segments = []  # 按起始时间排序，最后一个为当前写入的分区
+        self.pending = bytearray()  # 尚未写入文件的记录
+        self.pending_blocks = []  # 尚未写入索引文件的索引项
+        self.data_file = None
+        self.idx_file = None
+        self.closed = False
+
+        os.makedirs(root, exist_ok=True)
+        self._lock_file = open(os.path.join(root, "LOCK"), "w")
+        if fcntl is not None:
+            try:
+                fcntl.flock(self._lock_file, fcntl.LOCK_EX | fcntl.LOCK_NB)
+            except OSError:
+                raise RuntimeError("%s is in use by another process" % root)
+
+        start = time.perf_counter()
+        for name in sorted(os.listdir(root)):
+            if name.endswith(".seg"):
+                seg = _Segment(os.path.join(root, name), int(name[:-4]), block_records)
+                seg.load()
+                self.segments.append(seg)
+        if self.segments:
+            self._open_active(self.segments[-1])
+        self.recovery_seconds = time.perf_counter() - start  # 打开已有数据的耗时
+
+        self._wake = threading.Event()
+        self._flusher = threading.Thread(target=self._flush_loop, name="store-flush", daemon=True)
+        self._flusher.start()
+        atexit.register(self.close)
+
+    def __len__(self):
+        with self.lock:
+            return sum(seg.count for seg in self.segments)
+
+    def _open_active(self, seg):
+        if self.data_file is not None:
+            self.data_file.close()
+            self.idx_file.close()
+        self.data_file = open(seg.path, "ab")
+        self.idx_file = open(seg.idx_path, "ab")
+
+    def append(self, t, temp, humidity, light):
+        """追加一条记录（只写内存缓冲，由后台线程批量落盘）"""
+        with self.lock:
+            if self.closed:
+                raise RuntimeError("store is closed")
+            bucket = int(t // self.segment_seconds) * self.segment_seconds
+            if not self.segments or bucket > self.segments[-1].start:
+                self._write_pending()
+                seg = _Segment(os.path.join(self.root, "%012d.seg" % bucket), bucket, self.block_records)
+                seg.create()
+                self.segments.append(seg)
+                self._open_active(seg)
+            block = self.segments[-1].add(t)
+            self.pending += RECORD.pack(t, temp, humidity, light)
+            if block is not None:
+                self.pending_blocks.append(block)
+            if len(self.pending) >= self.flush_records * RECORD.size:
+                self._wake.set()
+
+    def _write_pending(self, sync=False):
+        """把缓冲写入当前分区（需持有lock）；先写数据再写索引，索引不会超前于数据"""
+        if self.pending:
+            self.data_file.write(self.pending)
+            self.data_file.flush()
+            self.pending = bytearray()
+        if sync and self.data_file is not None:
+            os.fsync(self.data_file.fileno())
+        if self.pending_blocks:
+            self.idx_file.write(b"".join(BLOCK.pack(*b) for b in self.pending_blocks))
+            self.idx_file.flush()
+            self.pending_blocks = []
+            if sync:
+                os.fsync(self.idx_file.fileno())
+
+    def flush(self):
+        """立即写入并fsync"""
+        with self.lock:
+            if not self.closed:
+                self._write_pending(sync=True)
+
+    def _flush_loop(self):
+        while not self.closed:
+            self._wake.wait(self.flush_interval)
+            self._wake.clear()
+            self.flush()
+            self._expire()
+
+    def _expire(self):
+        """删除整个分区都已超过保留期的旧分区（当前写入的分区除外）"""
+        if self.retention_seconds <= 0:
+            return
+        deadline = time.time() - self.retention_seconds
+        with self.lock:
+            while len(self.segments) > 1 and self.segments[0].max_time < deadline:
+                seg = self.segments.pop(0)
+                seg.expired = True
+                os.remove(seg.path)
+                os.remove(seg.idx_path)
+
+    def close(self):
+        """落盘并关闭文件（进程退出时自动调用）"""
+        with self.lock:
+            if self.closed:
+                return
+            self._write_pending(sync=True)
+            self.closed = True
+            if self.data_file is not None:
+                self.data_file.close()
+                self.idx_file.close()
+            self._lock_file.close()
+        self._wake.set()
+
+    def _snapshot(self):
+        """写出缓冲后返回各分区的(分区, 记录数)，读文件时不必持有lock"""
+        with self.lock:
+            if not self.closed:
+                self._write_pending()
+            return [(seg, seg.count) for seg in self.segments]
+
+    def query(self, start_time, end_time, limit=None):
+        """
+        时间在[start_time, end_time]内的记录，按写入顺序返回
+
+        limit不为None时只返回写入顺序上最近的limit条（从最新的块往前读，读够即停）。
+        """
+        out = []
+        total = 0
+        for seg, count in reversed(self._snapshot()):
+            if seg.min_time > end_time or seg.max_time < start_time:
+                continue
+            for first, stop in reversed(seg.candidate_runs(start_time, end_time, count)):
+                rows = [r for r in seg.read(first, stop) if start_time <= r[0] <= end_time]
+                out.append(rows)
+                total += len(rows)
+                if limit is not None and total >= limit:
+                    return self._join(out)[-limit:] if limit > 0 else []
+        return self._join(out)
+
+    def tail(self, n):
+        """写入顺序上最近的n条记录"""
+        return [r for chunk in self.iter_tail(n) for r in chunk]
+
+    def iter_tail(self, n, chunk_records=4096):
+        """
+        按写入顺序逐块返回最近的n条记录，每块最多chunk_records条
+
+        用于启动时把大量记录装入内存历史，任一时刻只有一块记录被解包，
+        不需要先拼出全部n条记录的列表。
+        """
+        runs = []
+        for seg, count in reversed(self._snapshot()):
+            if n <= 0:
+                break
+            first = max(0, count - n)
+            runs.append((seg, first, count))
+            n -= count - first
+        for seg, first, stop in reversed(runs):
+            for i in range(first, stop, chunk_records):
+                chunk = seg.read(i, min(i + chunk_records, stop))
+                if chunk:
+                    yield chunk
+
+    @staticmethod
+    def _join(chunks):
+        """把从新到旧收集的分块拼接成按写入顺序排列的列表"""
+        return [r for chunk in reversed(chunks) for r in chunk]
@@ -11,6 +11,7 @@
 #include "aht20.h"         // AHT20头文件
 #include <rtdevice.h>      // RT设备驱动框架
 #include <board.h>         // 板级支持包
+#include "perf.h"          // 性能剖析
 
 #define AHT20_ADDR 0x38  // AHT20传感器I2C地址
 
@@ -72,6 +73,7 @@ rt_err_t aht20_read_temperature_humidity(aht20_device_t device, float *temp, flo
 
     uint8_t cmd[3] = {0xAC, 0x33, 0x00};  // 触发测量命令
     uint8_t data[6] = {0};  // 数据接收缓冲区
+    rt_size_t len;          // 实际收发字节数
 
     // 校验输入参数有效性
     RT_ASSERT(device != RT_NULL);
@@ -79,14 +81,22 @@ rt_err_t aht20_read_temperature_humidity(aht20_device_t device, float *temp, flo
     RT_ASSERT(humi != RT_NULL);
 
     // 发送测量命令
-    if (rt_i2c_master_send(dev->bus, AHT20_ADDR, 0, cmd, 3) != 3) {
+    PERF_BEGIN(PERF_AHT20_SEND);
+    len = rt_i2c_master_send(dev->bus, AHT20_ADDR, 0, cmd, 3);
+    PERF_END(PERF_AHT20_SEND);
+    if (len != 3) {
         return RT_ERROR;
     }
 
+    PERF_BEGIN(PERF_AHT20_CONVERT);
     rt_thread_mdelay(85);  // 等待测量完成
+    PERF_END(PERF_AHT20_CONVERT);
 
     // 读取测量数据
-    if (rt_i2c_master_recv(dev->bus, AHT20_ADDR, 0, data, 6) != 6) {
+    PERF_BEGIN(PERF_AHT20_RECV);
+    len = rt_i2c_master_recv(dev->bus, AHT20_ADDR, 0, data, 6);
+    PERF_END(PERF_AHT20_RECV);
+    if (len != 6) {
         return RT_ERROR;
     }
 
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         启动时间线
+ */
+
+#include "boot_time.h"     // 启动时间线头文件
+#include "wall_time.h"     // 节拍加SysTick计数的微秒时间
+
+static rt_uint32_t marks[BOOT_EVT_MAX];     // 各里程碑时刻（us），0表示尚未到达
+
+static const char *mark_names[BOOT_EVT_MAX] = {
+    "main", "splash", "first sample", "first frame",
+    "wifi start", "ip acquired", "reachable", "first upload"
+};
+
+/**
+ * 记录启动里程碑
+ *
+ * @param evt 里程碑
+ */
+void boot_mark(boot_evt_t evt)
+{
+    rt_uint32_t now = wall_time_us();
+
+    if (evt >= BOOT_EVT_MAX || marks[evt] != 0) {
+        return;
+    }
+    marks[evt] = now ? now : 1;
+
+    if (evt == BOOT_FIRST_UPLOAD) {
+        rt_kprintf("[BOOT] first sample %d ms, first frame %d ms, ip %d ms, first upload %d ms\n",
+                   marks[BOOT_FIRST_SAMPLE] / 1000, marks[BOOT_FIRST_FRAME] / 1000,
+                   marks[BOOT_IP_ACQUIRED] / 1000, marks[BOOT_FIRST_UPLOAD] / 1000);
+    }
+}
+
+/**
+ * msh命令：按时间顺序输出启动时间线
+ *
+ * 时刻从系统节拍启动算起（复位后的时钟配置和C运行时初始化不计入，约数毫秒）。
+ */
+static int boot(int argc, char **argv)
+{
+    int order[BOOT_EVT_MAX];
+    rt_uint32_t prev = 0;
+    int i, j, n = 0;
+
+    /* 已到达的里程碑按时刻插入排序 */
+    for (i = 0; i < BOOT_EVT_MAX; i++) {
+        if (marks[i] == 0) {
+            continue;
+        }
+        for (j = n; j > 0 && marks[order[j - 1]] > marks[i]; j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+        n++;
+    }
+
+    rt_kprintf("%-14s %10s %10s\n", "milestone", "at(ms)", "delta(ms)");
+    for (i = 0; i < n; i++) {
+        rt_uint32_t at = marks[order[i]];
+        rt_kprintf("%-14s %6d.%03d %6d.%03d\n", mark_names[order[i]],
+                   at / 1000, at % 1000, (at - prev) / 1000, (at - prev) % 1000);
+        prev = at;
+    }
+    for (i = 0; i < BOOT_EVT_MAX; i++) {
+        if (marks[i] == 0) {
+            rt_kprintf("%-14s %10s\n", mark_names[i], "-");
+        }
+    }
+    return 0;
+}
+MSH_CMD_EXPORT(boot, show boot timeline);
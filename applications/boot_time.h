@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         启动时间线
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __BOOT_TIME_H__
+#define __BOOT_TIME_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 启动里程碑 */
+typedef enum {
+    BOOT_MAIN = 0,          // 进入main（内核与组件初始化完成）
+    BOOT_SPLASH,            // 开机画面绘制完成
+    BOOT_FIRST_SAMPLE,      // 第一次读到温湿度
+    BOOT_FIRST_FRAME,       // 第一帧传感器数据显示完成
+    BOOT_WIFI_START,        // 开始连接热点
+    BOOT_IP_ACQUIRED,       // 获取IP
+    BOOT_REACHABLE,         // 上传服务器可达
+    BOOT_FIRST_UPLOAD,      // 第一次上传成功
+    BOOT_EVT_MAX
+} boot_evt_t;
+
+/**
+ * 记录启动里程碑（每个里程碑只记录第一次，可在任意线程调用）
+ *
+ * 第一次上传成功时输出一行启动时间汇总。
+ *
+ * @param evt 里程碑
+ */
+void boot_mark(boot_evt_t evt);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
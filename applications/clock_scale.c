@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         运行时动态调频
+ */
+
+#include "clock_scale.h"   // 调频头文件
+#include <rtdevice.h>      // 串口、SPI设备
+#include <board.h>         // RCC、SysTick寄存器
+#include "disp_power.h"    // 背光PWM重新设置
+
+#ifdef RW007_SPI_BUS_NAME
+#define CLOCK_SPI_BUS       RW007_SPI_BUS_NAME  // 需要重新计算分频的SPI总线
+#define CLOCK_SPI           SPI2
+#endif
+
+/*
+ * 各档位的分频配置
+ *
+ * APB1最高42MHz、APB2最高84MHz。定时器时钟按PCLK的2倍计算（drv_pwm的约定），
+ * 因此APB1始终保持至少2分频。Flash等待周期按3.3V供电取值。
+ */
+struct clock_cfg {
+    rt_uint32_t hpre;       // AHB分频
+    rt_uint32_t ppre1;      // APB1分频
+    rt_uint32_t ppre2;      // APB2分频
+    rt_uint32_t latency;    // Flash等待周期
+};
+
+static const struct clock_cfg levels[CLOCK_LEVEL_MAX] = {
+    { RCC_CFGR_HPRE_DIV8, RCC_CFGR_PPRE1_DIV2, RCC_CFGR_PPRE2_DIV1, FLASH_LATENCY_0 },   // 21/10.5/21MHz
+    { RCC_CFGR_HPRE_DIV2, RCC_CFGR_PPRE1_DIV2, RCC_CFGR_PPRE2_DIV1, FLASH_LATENCY_2 },   // 84/42/84MHz
+    { RCC_CFGR_HPRE_DIV1, RCC_CFGR_PPRE1_DIV4, RCC_CFGR_PPRE2_DIV2, FLASH_LATENCY_5 },   // 168/42/84MHz
+};
+
+static const char *level_names[CLOCK_LEVEL_MAX] = { "low", "mid", "high" };
+
+static struct rt_mutex clock_lock;
+static rt_bool_t clock_ready = RT_FALSE;    // 初始化前一直满速，申请/释放直接返回
+static rt_uint16_t votes[CLOCK_LEVEL_MAX];  // 各档位的申请计数
+static clock_level_t current = CLOCK_LEVEL_HIGH;  // 当前档位（上电为满速）
+static int forced = -1;                     // msh命令固定的档位，-1为自动
+
+static rt_uint32_t console_baud;            // 控制台波特率
+#ifdef CLOCK_SPI_BUS
+static struct rt_spi_bus *spi_bus = RT_NULL;
+static rt_uint32_t spi_sck_hz;              // 满速时的SPI时钟，各档位不超过该值
+#endif
+
+/* 统计 */
+static rt_tick_t level_since;               // 进入当前档位的时刻
+static rt_uint64_t level_ticks[CLOCK_LEVEL_MAX];    // 各档位累计时间
+static rt_uint32_t level_enters[CLOCK_LEVEL_MAX];   // 各档位进入次数
+
+/**
+ * 写入AHB/APB分频和Flash等待周期（调用时已关中断）
+ *
+ * 升频时先增加等待周期、先调APB分频，降频时顺序相反，保证切换过程中不超限。
+ */
+static void clock_scale_set_dividers(const struct clock_cfg *cfg)
+{
+    rt_bool_t up = cfg->latency > (FLASH->ACR & FLASH_ACR_LATENCY);
+
+    if (up) {
+        __HAL_FLASH_SET_LATENCY(cfg->latency);
+        MODIFY_REG(RCC->CFGR, RCC_CFGR_PPRE1 | RCC_CFGR_PPRE2, cfg->ppre1 | cfg->ppre2);
+        MODIFY_REG(RCC->CFGR, RCC_CFGR_HPRE, cfg->hpre);
+    } else {
+        MODIFY_REG(RCC->CFGR, RCC_CFGR_HPRE, cfg->hpre);
+        MODIFY_REG(RCC->CFGR, RCC_CFGR_PPRE1 | RCC_CFGR_PPRE2, cfg->ppre1 | cfg->ppre2);
+        __HAL_FLASH_SET_LATENCY(cfg->latency);
+    }
+    SystemCoreClockUpdate();
+}
+
+#ifdef CLOCK_SPI_BUS
+/**
+ * 按当前PCLK1选择不超过目标频率的最小SPI分频
+ */
+static rt_uint32_t clock_scale_spi_br(rt_uint32_t pclk)
+{
+    rt_uint32_t br = 0;
+
+    while (br < 7 && (pclk >> (br + 1)) > spi_sck_hz) {
+        br++;
+    }
+    return br << SPI_CR1_BR_Pos;
+}
+#endif
+
+/**
+ * 切换到指定档位并重新计算依赖时钟的外设参数（持有clock_lock时调用）
+ */
+static void clock_scale_apply(clock_level_t to)
+{
+    rt_uint32_t old_hclk = SystemCoreClock;
+    rt_uint32_t remain;
+#ifdef CLOCK_SPI_BUS
+    rt_uint32_t cr1;
+#endif
+    rt_base_t level;
+    rt_tick_t now;
+
+#ifdef CLOCK_SPI_BUS
+    /* 持有总线锁，保证切换时没有SPI传输 */
+    if (spi_bus != RT_NULL) {
+        rt_mutex_take(&spi_bus->lock, RT_WAITING_FOREVER);
+    }
+#endif
+
+    level = rt_hw_interrupt_disable();
+
+    /* 等待串口发完当前字符，避免在字符中途改变波特率 */
+    while (!(USART1->SR & USART_SR_TC));
+
+    clock_scale_set_dividers(&levels[to]);
+
+    /*
+     * SysTick以HCLK计数。写VAL只能清零，为了不丢失当前节拍已走过的时间，
+     * 先把LOAD设为剩余时间在新频率下的计数并清零VAL，计数器在下一个时钟重装后
+     * 再写入新的重装值，当前这一拍仍按原定时刻结束。
+     */
+    remain = (rt_uint64_t)SysTick->VAL * SystemCoreClock / old_hclk;
+    SysTick->LOAD = (remain < 16) ? 16 : remain;
+    SysTick->VAL = 0;
+    while (SysTick->VAL == 0);
+    SysTick->LOAD = SystemCoreClock / RT_TICK_PER_SECOND - 1;
+
+    if (console_baud) {
+        USART1->BRR = UART_BRR_SAMPLING16(HAL_RCC_GetPCLK2Freq(), console_baud);
+    }
+
+    now = rt_tick_get();
+    level_ticks[current] += now - level_since;
+    level_since = now;
+    level_enters[to]++;
+    current = to;
+
+    rt_hw_interrupt_enable(level);
+
+#ifdef CLOCK_SPI_BUS
+    if (spi_bus != RT_NULL) {
+        while (CLOCK_SPI->SR & SPI_SR_BSY);
+        cr1 = CLOCK_SPI->CR1;
+        CLOCK_SPI->CR1 = cr1 & ~SPI_CR1_SPE;
+        CLOCK_SPI->CR1 = (cr1 & ~SPI_CR1_BR) | clock_scale_spi_br(HAL_RCC_GetPCLK1Freq());
+        rt_mutex_release(&spi_bus->lock);
+    }
+#endif
+
+    /* 背光PWM的定时器时钟随APB1变化，由PWM驱动按新时钟重新计算 */
+    disp_power_refresh();
+}
+
+/**
+ * 根据申请计数（或msh固定档位）选择目标档位并切换（持有clock_lock时调用）
+ */
+static void clock_scale_update(void)
+{
+    clock_level_t target = CLOCK_LEVEL_LOW;
+    int i;
+
+    if (forced >= 0) {
+        target = (clock_level_t)forced;
+    } else {
+        for (i = CLOCK_LEVEL_MAX - 1; i > CLOCK_LEVEL_LOW; i--) {
+            if (votes[i]) {
+                target = (clock_level_t)i;
+                break;
+            }
+        }
+    }
+
+    if (target != current) {
+        clock_scale_apply(target);
+    }
+}
+
+/**
+ * 申请至少某一档性能
+ *
+ * @param level 需要的档位
+ */
+void clock_scale_request(clock_level_t level)
+{
+    if (!clock_ready) {
+        return;
+    }
+    rt_mutex_take(&clock_lock, RT_WAITING_FOREVER);
+    votes[level]++;
+    clock_scale_update();
+    rt_mutex_release(&clock_lock);
+}
+
+/**
+ * 释放之前申请的档位
+ *
+ * @param level 申请时的档位
+ */
+void clock_scale_release(clock_level_t level)
+{
+    if (!clock_ready) {
+        return;
+    }
+    rt_mutex_take(&clock_lock, RT_WAITING_FOREVER);
+    if (votes[level] > 0) {
+        votes[level]--;
+    }
+    clock_scale_update();
+    rt_mutex_release(&clock_lock);
+}
+
+/**
+ * 从STOP模式唤醒后恢复PLL并重新设置当前档位的分频
+ *
+ * SystemClock_Config按满速配置分频，外设参数仍按当前档位计算，
+ * 所以这里只需把分频改回当前档位。
+ */
+void clock_scale_resume(void)
+{
+    SystemClock_Config();
+    clock_scale_set_dividers(&levels[current]);
+}
+
+/**
+ * 初始化调频模块
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t clock_scale_init(void)
+{
+    rt_device_t console = rt_console_get_device();
+
+    if (rt_mutex_init(&clock_lock, "clk_lock", RT_IPC_FLAG_PRIO) != RT_EOK) {
+        return -RT_ERROR;
+    }
+
+    if (console != RT_NULL) {
+        console_baud = ((struct rt_serial_device *)console)->config.baud_rate;
+    }
+
+#ifdef CLOCK_SPI_BUS
+    /* 以满速时驱动配置的SPI时钟为上限，降频后选最接近的分频 */
+    spi_bus = (struct rt_spi_bus *)rt_device_find(CLOCK_SPI_BUS);
+    if (spi_bus != RT_NULL) {
+        spi_sck_hz = HAL_RCC_GetPCLK1Freq() >> (((CLOCK_SPI->CR1 & SPI_CR1_BR) >> SPI_CR1_BR_Pos) + 1);
+    }
+#endif
+
+    level_since = rt_tick_get();
+    clock_ready = RT_TRUE;
+    rt_mutex_take(&clock_lock, RT_WAITING_FOREVER);
+    clock_scale_update();
+    rt_mutex_release(&clock_lock);
+
+    return RT_EOK;
+}
+
+/**
+ * msh命令：查看各档位时间占比，或固定档位
+ *
+ * 用法：clock [low|mid|high|auto|reset]
+ */
+static int clock(int argc, char **argv)
+{
+    rt_uint64_t ticks[CLOCK_LEVEL_MAX], total = 0;
+    rt_base_t level;
+    int i;
+
+    if (argc > 1) {
+        rt_mutex_take(&clock_lock, RT_WAITING_FOREVER);
+        forced = -1;
+        for (i = 0; i < CLOCK_LEVEL_MAX; i++) {
+            if (rt_strcmp(argv[1], level_names[i]) == 0) {
+                forced = i;
+            }
+        }
+        if (rt_strcmp(argv[1], "reset") == 0) {
+            level = rt_hw_interrupt_disable();
+            rt_memset(level_ticks, 0, sizeof(level_ticks));
+            rt_memset(level_enters, 0, sizeof(level_enters));
+            level_since = rt_tick_get();
+            rt_hw_interrupt_enable(level);
+        }
+        clock_scale_update();
+        rt_mutex_release(&clock_lock);
+    }
+
+    level = rt_hw_interrupt_disable();
+    rt_memcpy(ticks, level_ticks, sizeof(ticks));
+    ticks[current] += rt_tick_get() - level_since;
+    rt_hw_interrupt_enable(level);
+
+    for (i = 0; i < CLOCK_LEVEL_MAX; i++) {
+        total += ticks[i];
+    }
+    if (total == 0) {
+        total = 1;
+    }
+
+    rt_kprintf("clock: %s (%s), HCLK %d MHz, PCLK1 %d MHz, PCLK2 %d MHz\n",
+               level_names[current], forced >= 0 ? "fixed" : "auto",
+               SystemCoreClock / 1000000, HAL_RCC_GetPCLK1Freq() / 1000000, HAL_RCC_GetPCLK2Freq() / 1000000);
+    rt_kprintf("level      time(s)   share  enters  votes\n");
+    for (i = 0; i < CLOCK_LEVEL_MAX; i++) {
+        rt_kprintf("%-6s %11d %6d%% %7d %6d\n", level_names[i],
+                   (rt_uint32_t)(ticks[i] / RT_TICK_PER_SECOND),
+                   (rt_uint32_t)(ticks[i] * 100 / total), level_enters[i], votes[i]);
+    }
+    return 0;
+}
+MSH_CMD_EXPORT(clock, dynamic clock scaling: clock [low|mid|high|auto|reset]);
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         运行时动态调频
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __CLOCK_SCALE_H__
+#define __CLOCK_SCALE_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 性能档位（PLL固定168MHz，只改AHB/APB分频，切换无需等待PLL锁定） */
+typedef enum {
+    CLOCK_LEVEL_LOW = 0,    // HCLK 21MHz：只有周期采样时
+    CLOCK_LEVEL_MID,        // HCLK 84MHz：普通上传（APB时钟与满速时相同）
+    CLOCK_LEVEL_HIGH,       // HCLK 168MHz：TLS握手、LCD绘制、积压补传
+    CLOCK_LEVEL_MAX
+} clock_level_t;
+
+/**
+ * 初始化调频模块，记录串口波特率和SPI目标频率后切换到最低档
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t clock_scale_init(void);
+
+/**
+ * 申请至少某一档性能，返回时已切换完成（可嵌套，须与clock_scale_release成对使用）
+ *
+ * 切换时重新计算SysTick重装值、控制台串口波特率、SPI分频和背光PWM，
+ * 只能在线程中调用。
+ *
+ * @param level 需要的档位
+ */
+void clock_scale_request(clock_level_t level);
+
+/**
+ * 释放之前申请的档位，没有更高的申请时降频
+ *
+ * @param level 申请时的档位
+ */
+void clock_scale_release(clock_level_t level);
+
+/**
+ * 从STOP模式唤醒后恢复PLL并重新设置当前档位的分频（关中断时调用）
+ */
+void clock_scale_resume(void);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
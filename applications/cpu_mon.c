@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         线程CPU占用与调度延迟监视
+ */
+
+#include "cpu_mon.h"       // CPU监视头文件
+#include <rtdevice.h>      // RT设备驱动框架
+#include <board.h>         // DWT周期计数器
+#include "trace.h"         // 线程切换转发给事件跟踪
+#include "dlog.h"          // 遥测记录
+
+#define CPU_MON_MAX_THREADS 24       // 最多跟踪的线程数
+#define CPU_MON_PERIOD_MS   10000    // 统计周期（毫秒）
+#define CPU_MON_TOP_N       3        // 遥测记录中列出的线程数
+#define CPU_MON_FRAC_BITS   10       // 运行时间的单位：1/1024纳秒
+
+/*
+ * 每个线程的统计槽
+ *
+ * 运行时间在切换时由DWT周期按当时的主频换算后累加，中断处理时间计入被打断的线程。
+ * 主频随clock_scale档位变化，累计周期数会让低档位下的运行时间在占比中被低估，
+ * 跨越档位切换的那一段按切换后的主频换算，误差不超过一个运行片段。
+ * 唤醒延迟为线程变为就绪（IPC唤醒或定时器到期）到真正开始运行的时间。
+ */
+struct cpu_mon_slot {
+    rt_thread_t thread;             // 线程句柄，RT_NULL表示空闲槽
+    char name[RT_NAME_MAX + 1];     // 线程名
+    rt_uint64_t run;                // 累计运行时间（1/1024纳秒）
+    rt_uint64_t run_prev;           // 上个周期结束时的累计运行时间
+    rt_uint32_t load;               // 上个周期的CPU占用（千分比）
+    rt_uint32_t switches;           // 切入次数
+    rt_uint32_t ready_at;           // 变为就绪时的周期计数
+    rt_bool_t ready_valid;          // ready_at是否有效
+    rt_uint32_t wakeups;            // 统计到的唤醒次数
+    rt_uint64_t lat_sum;            // 唤醒延迟总和（纳秒）
+    rt_uint32_t lat_max;            // 最大唤醒延迟（纳秒）
+};
+
+static struct cpu_mon_slot slots[CPU_MON_MAX_THREADS];
+static rt_uint32_t last_switch;     // 上次切换时的周期计数
+static rt_uint32_t dropped;         // 槽位已满未能跟踪的切换次数
+static rt_uint32_t cpu_load;        // 上个周期的CPU负载（千分比）
+
+/**
+ * 按当前主频把周期数换算为运行时间（1/1024纳秒）
+ *
+ * 每周期的时间取定点数，只需一次32位除法和一次乘法，适合在调度器钩子中调用。
+ */
+static rt_uint64_t cpu_mon_time(rt_uint32_t cycles)
+{
+    return (rt_uint64_t)cycles * ((1000U << CPU_MON_FRAC_BITS) / (SystemCoreClock / 1000000));
+}
+
+/**
+ * 查找线程的统计槽，不存在时分配（调用时须已关中断）
+ */
+static struct cpu_mon_slot *cpu_mon_slot(rt_thread_t thread, rt_bool_t alloc)
+{
+    struct cpu_mon_slot *empty = RT_NULL;
+    int i;
+
+    for (i = 0; i < CPU_MON_MAX_THREADS; i++) {
+        if (slots[i].thread == thread) {
+            return &slots[i];
+        }
+        if (empty == RT_NULL && slots[i].thread == RT_NULL) {
+            empty = &slots[i];
+        }
+    }
+    if (!alloc || empty == RT_NULL) {
+        return RT_NULL;
+    }
+
+    rt_memset(empty, 0, sizeof(*empty));
+    empty->thread = thread;
+    rt_strncpy(empty->name, thread->name, RT_NAME_MAX);
+
+    return empty;
+}
+
+/**
+ * 调度器钩子：结算切出线程的运行时间，统计切入线程的唤醒延迟
+ */
+static void cpu_mon_scheduler_hook(rt_thread_t from, rt_thread_t to)
+{
+    rt_uint32_t now = DWT->CYCCNT;
+    struct cpu_mon_slot *slot;
+    rt_uint64_t ns;
+    rt_uint32_t lat;
+
+    slot = cpu_mon_slot(from, RT_TRUE);
+    if (slot != RT_NULL) {
+        slot->run += cpu_mon_time(now - last_switch);
+    }
+
+    slot = cpu_mon_slot(to, RT_TRUE);
+    if (slot != RT_NULL) {
+        slot->switches++;
+        if (slot->ready_valid) {
+            ns = cpu_mon_time(now - slot->ready_at) >> CPU_MON_FRAC_BITS;
+            lat = (ns > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (rt_uint32_t)ns;
+            slot->ready_valid = RT_FALSE;
+            slot->wakeups++;
+            slot->lat_sum += lat;
+            if (lat > slot->lat_max) {
+                slot->lat_max = lat;
+            }
+        }
+    } else {
+        dropped++;
+    }
+
+    last_switch = now;
+
+    /* 调度器钩子只有一个，由这里转发给事件跟踪 */
+    TRACE_SWITCH(from, to);
+}
+
+/**
+ * 记录线程变为就绪的时刻
+ */
+static void cpu_mon_mark_ready(rt_thread_t thread)
+{
+    struct cpu_mon_slot *slot;
+    rt_base_t level;
+
+    level = rt_hw_interrupt_disable();
+    slot = cpu_mon_slot(thread, RT_FALSE);
+    if (slot != RT_NULL && !slot->ready_valid) {
+        slot->ready_at = DWT->CYCCNT;
+        slot->ready_valid = RT_TRUE;
+    }
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * 定时器钩子：线程自身的定时器到期（睡眠结束或IPC等待超时）时线程变为就绪
+ */
+static void cpu_mon_timer_hook(struct rt_timer *timer)
+{
+    rt_thread_t thread = rt_container_of(timer, struct rt_thread, thread_timer);
+
+    if (timer->parameter == thread) {
+        cpu_mon_mark_ready(thread);
+    }
+}
+
+/**
+ * 释放已删除线程的统计槽
+ */
+static void cpu_mon_prune(void)
+{
+    struct rt_object_information *info = rt_object_get_information(RT_Object_Class_Thread);
+    struct rt_list_node *node;
+    rt_bool_t alive;
+    int i;
+
+    rt_enter_critical();
+    for (i = 0; i < CPU_MON_MAX_THREADS; i++) {
+        if (slots[i].thread == RT_NULL) {
+            continue;
+        }
+        alive = RT_FALSE;
+        for (node = info->object_list.next; node != &info->object_list; node = node->next) {
+            if ((rt_thread_t)rt_list_entry(node, struct rt_object, list) == slots[i].thread) {
+                alive = RT_TRUE;
+                break;
+            }
+        }
+        if (!alive) {
+            slots[i].thread = RT_NULL;
+        }
+    }
+    rt_exit_critical();
+}
+
+/**
+ * 结束一个统计周期：计算各线程CPU占用并输出遥测记录
+ */
+static void cpu_mon_roll(void)
+{
+    struct cpu_mon_slot *top[CPU_MON_TOP_N] = {RT_NULL};
+    rt_uint64_t delta[CPU_MON_MAX_THREADS];
+    rt_uint64_t total = 0;
+    rt_thread_t idle = rt_thread_idle_gethandler();
+    rt_base_t level;
+    int i, j;
+
+    cpu_mon_prune();
+
+    level = rt_hw_interrupt_disable();
+    for (i = 0; i < CPU_MON_MAX_THREADS; i++) {
+        delta[i] = slots[i].run - slots[i].run_prev;
+        slots[i].run_prev = slots[i].run;
+        total += delta[i];
+    }
+    for (i = 0; i < CPU_MON_MAX_THREADS; i++) {
+        slots[i].load = total ? (rt_uint32_t)(delta[i] * 1000 / total) : 0;
+        if (slots[i].thread == idle) {
+            cpu_load = 1000 - slots[i].load;
+        }
+    }
+    rt_hw_interrupt_enable(level);
+
+    /* 找出占用最高的几个非空闲线程 */
+    for (i = 0; i < CPU_MON_MAX_THREADS; i++) {
+        if (slots[i].thread == RT_NULL || slots[i].thread == idle) {
+            continue;
+        }
+        for (j = 0; j < CPU_MON_TOP_N; j++) {
+            if (top[j] == RT_NULL || slots[i].load > top[j]->load) {
+                rt_memmove(&top[j + 1], &top[j], (CPU_MON_TOP_N - j - 1) * sizeof(top[0]));
+                top[j] = &slots[i];
+                break;
+            }
+        }
+    }
+
+    /* 每条日志最多DLOG_MAX_ARGS个参数，总负载和各线程分别记录 */
+    DLOG_I("[CPU] load %d.%d%%\n", cpu_load / 10, cpu_load % 10);
+    for (j = 0; j < CPU_MON_TOP_N && top[j] != RT_NULL; j++) {
+        DLOG_I("[CPU]   #%d %s %d.%d%%\n", j + 1, top[j]->name, top[j]->load / 10, top[j]->load % 10);
+    }
+}
+
+/**
+ * 统计线程入口
+ */
+static void cpu_mon_thread_entry(void *parameter)
+{
+    while (1) {
+        rt_thread_mdelay(CPU_MON_PERIOD_MS);
+        cpu_mon_roll();
+    }
+}
+
+/**
+ * 安装调度器/线程恢复/定时器钩子并启动统计线程
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t cpu_mon_init(void)
+{
+    rt_thread_t tid;  // 线程句柄
+
+    /* 启用DWT周期计数器 */
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    last_switch = DWT->CYCCNT;
+    rt_scheduler_sethook(cpu_mon_scheduler_hook);
+    rt_thread_resume_sethook(cpu_mon_mark_ready);
+    rt_timer_enter_sethook(cpu_mon_timer_hook);
+
+    tid = rt_thread_create("cpu_mon", cpu_mon_thread_entry, RT_NULL, 1024, 29, 5);
+    if (tid == RT_NULL) {
+        return -RT_ENOMEM;
+    }
+
+    return rt_thread_startup(tid);
+}
+
+/**
+ * 获取上一个统计周期的CPU负载
+ *
+ * @return 负载千分比（1000减去空闲线程占比）
+ */
+rt_uint32_t cpu_mon_load(void)
+{
+    return cpu_load;
+}
+
+/**
+ * 把一段睡眠时间计入空闲线程
+ */
+void cpu_mon_idle_credit(rt_uint32_t us)
+{
+    struct cpu_mon_slot *slot;
+    rt_base_t level;
+
+    level = rt_hw_interrupt_disable();
+    slot = cpu_mon_slot(rt_thread_idle_gethandler(), RT_TRUE);
+    if (slot != RT_NULL) {
+        slot->run += ((rt_uint64_t)us * 1000) << CPU_MON_FRAC_BITS;
+    }
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * msh命令：按线程列出CPU占用、切换次数和唤醒延迟
+ *
+ * 用法：top [reset]，CPU占用为上一个统计周期的值，其余为累计值。
+ */
+static int top(int argc, char **argv)
+{
+    struct cpu_mon_slot snapshot;
+    rt_base_t level;
+    int i;
+
+    if (argc > 1 && rt_strcmp(argv[1], "reset") == 0) {
+        level = rt_hw_interrupt_disable();
+        for (i = 0; i < CPU_MON_MAX_THREADS; i++) {
+            slots[i].switches = 0;
+            slots[i].wakeups = 0;
+            slots[i].lat_sum = 0;
+            slots[i].lat_max = 0;
+        }
+        dropped = 0;
+        rt_hw_interrupt_enable(level);
+        return 0;
+    }
+
+    rt_kprintf("CPU load %d.%d%% (period %d s)\n", cpu_load / 10, cpu_load % 10, CPU_MON_PERIOD_MS / 1000);
+    rt_kprintf("%-8s %3s %6s %9s %11s %11s\n", "thread", "pri", "cpu%", "switches", "lat avg(us)", "lat max(us)");
+    for (i = 0; i < CPU_MON_MAX_THREADS; i++) {
+        level = rt_hw_interrupt_disable();
+        snapshot = slots[i];
+        rt_hw_interrupt_enable(level);
+
+        if (snapshot.thread == RT_NULL) {
+            continue;
+        }
+        rt_kprintf("%-8s %3d %4d.%d %9d %11d %11d\n", snapshot.name,
+                   snapshot.thread->current_priority,
+                   snapshot.load / 10, snapshot.load % 10, snapshot.switches,
+                   snapshot.wakeups ? (rt_uint32_t)(snapshot.lat_sum / snapshot.wakeups / 1000) : 0,
+                   snapshot.lat_max / 1000);
+    }
+    if (dropped) {
+        rt_kprintf("untracked switches: %d (raise CPU_MON_MAX_THREADS)\n", dropped);
+    }
+
+    return 0;
+}
+MSH_CMD_EXPORT(top, show per-thread CPU usage and wakeup latency);
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         线程CPU占用与调度延迟监视
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __CPU_MON_H__
+#define __CPU_MON_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 安装调度器/线程恢复/定时器钩子并启动统计线程
+ *
+ * 统计线程每个统计周期计算一次各线程CPU占用，通过dlog输出[CPU]遥测记录
+ * （总负载和占用最高的几个线程）。
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t cpu_mon_init(void);
+
+/**
+ * 获取上一个统计周期的CPU负载
+ *
+ * @return 负载千分比（1000减去空闲线程占比）
+ */
+rt_uint32_t cpu_mon_load(void);
+
+/**
+ * 把一段睡眠时间计入空闲线程（由低功耗空闲钩子在关中断时调用）
+ *
+ * WFI/STOP期间DWT周期计数器停止，这段时间不会出现在按周期累加的运行时间中，
+ * 不计入时空闲占比偏低，CPU负载接近100%。
+ *
+ * @param us 睡眠时长（微秒）
+ */
+void cpu_mon_idle_credit(rt_uint32_t us);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         背光自适应与显示电源管理
+ */
+
+#include "disp_power.h"  // 显示电源管理头文件
+#include <rtdevice.h>    // PWM设备
+#include <drv_lcd.h>     // LCD休眠/唤醒
+#include "lcd_fb.h"      // 与帧缓冲刷新互斥
+#include <stdlib.h>
+
+#define BL_PWM_DEVICE       "pwm14"     // 背光PWM设备
+#define BL_PWM_CHANNEL      1           // 背光PWM通道
+#define BL_PWM_PERIOD       50000       // PWM周期(ns)，20kHz避免可闻噪声
+
+#define DISP_PM_INTERVAL    200         // 管理线程周期(ms)
+#define DISP_DIM_TIMEOUT    (60 * 1000)     // 无活动多久后调暗(ms)
+#define DISP_SLEEP_TIMEOUT  (5 * 60 * 1000) // 无活动多久后休眠(ms)
+#define DISP_DIM_DUTY       8           // 调暗后的占空比(%)
+#define DISP_HYSTERESIS     6           // 目标占空比变化小于该值时不调整(%)
+#define DISP_RAMP_STEP      2           // 调暗时每周期最多降低的占空比(%)
+#define DISP_LUX_ALPHA      0.2f        // 照度指数平滑系数
+
+/* 能耗估算参数：背光满亮功耗、面板工作与休眠功耗(mW) */
+#define BL_FULL_MW          60
+#define PANEL_ON_MW         12
+#define PANEL_SLEEP_MW      0
+
+/* 照度->占空比曲线（人眼对亮度近似对数响应，低照度段取点更密），中间线性插值 */
+static const struct {
+    rt_uint16_t lux;
+    rt_uint8_t duty;
+} bl_curve[] = {
+    {0, 10}, {10, 20}, {50, 35}, {200, 55}, {1000, 80}, {5000, 100},
+};
+
+static struct rt_device_pwm *bl_dev = RT_NULL;  // 背光PWM设备
+static void (*disp_wake_hook)(void) = RT_NULL;   // 唤醒回调
+static disp_power_state_t state = DISP_POWER_ACTIVE;  // 当前状态
+static float lux_ema = -1.0f;           // 平滑后的照度（<0表示尚无数据）
+static rt_uint8_t target_duty = 100;    // 目标占空比
+static disp_power_state_t target_state = DISP_POWER_ACTIVE;  // 目标占空比对应的状态
+static rt_uint8_t duty = 100;           // 当前占空比
+static volatile rt_tick_t last_activity;   // 最近一次活动时刻
+static volatile rt_bool_t wake_pending = RT_FALSE;  // 休眠期间检测到活动
+
+/* 能耗统计（mW*ms） */
+static rt_uint64_t energy_used = 0;     // 实际估算能耗
+static rt_uint64_t energy_full = 0;     // 始终满亮时的能耗
+static rt_uint32_t stat_ms = 0;         // 统计时长
+
+/**
+ * 设置背光占空比
+ */
+static void disp_power_set_duty(rt_uint8_t percent)
+{
+    duty = percent;
+    if (bl_dev != RT_NULL) {
+        rt_pwm_set(bl_dev, BL_PWM_CHANNEL, BL_PWM_PERIOD, BL_PWM_PERIOD / 100 * percent);
+    }
+}
+
+/**
+ * 根据照度查表插值得到占空比
+ */
+static rt_uint8_t disp_power_curve(float lux)
+{
+    rt_uint32_t i;
+
+    if (lux <= bl_curve[0].lux) {
+        return bl_curve[0].duty;
+    }
+    for (i = 1; i < sizeof(bl_curve) / sizeof(bl_curve[0]); i++) {
+        if (lux < bl_curve[i].lux) {
+            float t = (lux - bl_curve[i - 1].lux) / (bl_curve[i].lux - bl_curve[i - 1].lux);
+            return bl_curve[i - 1].duty + (rt_uint8_t)(t * (bl_curve[i].duty - bl_curve[i - 1].duty));
+        }
+    }
+
+    return bl_curve[i - 1].duty;
+}
+
+/**
+ * 切换电源状态
+ */
+static void disp_power_switch(disp_power_state_t next)
+{
+    if (next == state) {
+        return;
+    }
+
+    /* 休眠/唤醒命令与显示线程的DMA刷新共用FSMC总线，等当前刷新结束后再发 */
+    if (next == DISP_POWER_SLEEP) {
+        disp_power_set_duty(0);
+        lcd_fb_lock();
+        lcd_enter_sleep();
+        lcd_fb_unlock();
+        rt_kprintf("[DISP] Sleep\n");
+    } else if (state == DISP_POWER_SLEEP) {
+        lcd_fb_lock();
+        lcd_exit_sleep();
+        lcd_fb_unlock();
+        rt_kprintf("[DISP] Wake up\n");
+    }
+    state = next;
+
+    /* 唤醒后补绘休眠期间被跳过的帧 */
+    if (next == DISP_POWER_ACTIVE && disp_wake_hook != RT_NULL) {
+        disp_wake_hook();
+    }
+}
+
+/**
+ * 显示电源管理线程入口函数
+ *
+ * @param parameter 线程参数
+ */
+static void disp_power_thread_entry(void *parameter)
+{
+    rt_tick_t idle;         // 无活动时长（tick）
+    rt_uint8_t want;        // 本周期的目标占空比
+
+    while (1) {
+        idle = rt_tick_get() - last_activity;
+
+        if (wake_pending || idle < rt_tick_from_millisecond(DISP_DIM_TIMEOUT)) {
+            wake_pending = RT_FALSE;
+            disp_power_switch(DISP_POWER_ACTIVE);
+        } else if (idle < rt_tick_from_millisecond(DISP_SLEEP_TIMEOUT)) {
+            disp_power_switch(DISP_POWER_DIM);
+        } else {
+            disp_power_switch(DISP_POWER_SLEEP);
+        }
+
+        if (state != DISP_POWER_SLEEP) {
+            /* 目标占空比带回差，避免照度在边界附近抖动时背光闪烁 */
+            want = (lux_ema < 0) ? 100 : disp_power_curve(lux_ema);
+            if (state == DISP_POWER_DIM && want > DISP_DIM_DUTY) {
+                want = DISP_DIM_DUTY;
+            }
+            /* 状态切换时立即更新目标，同一状态内变化超过回差才更新 */
+            if (state != target_state || abs((int)want - (int)target_duty) >= DISP_HYSTERESIS) {
+                target_duty = want;
+                target_state = state;
+            }
+
+            /*
+             * 调亮（唤醒、结束调暗、环境变亮）立即到位，用户操作后屏幕马上可读；
+             * 只有调暗时缓慢逼近目标值，避免亮度突降
+             */
+            if (duty < target_duty) {
+                disp_power_set_duty(target_duty);
+            } else if (duty > target_duty + DISP_RAMP_STEP) {
+                disp_power_set_duty(duty - DISP_RAMP_STEP);
+            } else if (duty != target_duty) {
+                disp_power_set_duty(target_duty);
+            }
+        }
+
+        /* 能耗估算：背光功耗与占空比成正比 */
+        energy_used += (rt_uint64_t)(BL_FULL_MW * duty / 100
+                       + (state == DISP_POWER_SLEEP ? PANEL_SLEEP_MW : PANEL_ON_MW)) * DISP_PM_INTERVAL;
+        energy_full += (rt_uint64_t)(BL_FULL_MW + PANEL_ON_MW) * DISP_PM_INTERVAL;
+        stat_ms += DISP_PM_INTERVAL;
+
+        rt_thread_mdelay(DISP_PM_INTERVAL);
+    }
+}
+
+/**
+ * 初始化显示电源管理（打开背光PWM并启动管理线程）
+ *
+ * @param wake_hook 屏幕从休眠唤醒后调用，用于请求重绘，可为RT_NULL
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t disp_power_init(void (*wake_hook)(void))
+{
+    rt_thread_t tid;  // 线程句柄
+
+    disp_wake_hook = wake_hook;
+    last_activity = rt_tick_get();
+
+    bl_dev = (struct rt_device_pwm *)rt_device_find(BL_PWM_DEVICE);
+    if (bl_dev == RT_NULL) {
+        rt_kprintf("[DISP] Backlight PWM %s not found\n", BL_PWM_DEVICE);
+        return -RT_ENOSYS;
+    }
+    disp_power_set_duty(100);
+    rt_pwm_enable(bl_dev, BL_PWM_CHANNEL);
+
+    tid = rt_thread_create("disp_pm", disp_power_thread_entry, RT_NULL, 1024, 28, 5);
+    if (tid == RT_NULL) {
+        return -RT_ENOMEM;
+    }
+
+    return rt_thread_startup(tid);
+}
+
+/**
+ * 输入环境光照度（由光照传感器线程调用）
+ *
+ * @param lux 照度
+ */
+void disp_power_lux(float lux)
+{
+    if (lux_ema < 0) {
+        lux_ema = lux;
+    } else {
+        lux_ema += DISP_LUX_ALPHA * (lux - lux_ema);
+    }
+}
+
+/**
+ * 报告有人活动，重新计时并唤醒屏幕
+ */
+void disp_power_activity(void)
+{
+    last_activity = rt_tick_get();
+    if (state != DISP_POWER_ACTIVE) {
+        wake_pending = RT_TRUE;
+    }
+}
+
+/**
+ * 按当前占空比重新设置背光PWM（系统时钟分频变化后调用）
+ */
+void disp_power_refresh(void)
+{
+    disp_power_set_duty(duty);
+}
+
+/**
+ * 查询屏幕是否处于可绘制状态
+ *
+ * @return 休眠时返回RT_FALSE
+ */
+rt_bool_t disp_power_is_on(void)
+{
+    return state != DISP_POWER_SLEEP;
+}
+
+/**
+ * msh命令：查看显示电源状态/手动唤醒
+ *
+ * 用法：disp_power [wake]
+ */
+static int disp_power_cmd(int argc, char **argv)
+{
+    static const char *names[] = {"active", "dim", "sleep"};
+    rt_uint32_t saved_mwh_day = 0;  // 每天节省的能量估算(mWh)
+
+    if (argc > 1 && rt_strcmp(argv[1], "wake") == 0) {
+        disp_power_activity();
+    }
+
+    if (stat_ms > 0) {
+        /* (满亮能耗-实际能耗)/统计时长，折算为每天 */
+        saved_mwh_day = (rt_uint32_t)((energy_full - energy_used) / stat_ms * 24);
+    }
+
+    rt_kprintf("state     : %s\n", names[state]);
+    rt_kprintf("lux (ema) : %d\n", (int)lux_ema);
+    rt_kprintf("duty      : %d%% (target %d%%)\n", duty, target_duty);
+    rt_kprintf("idle      : %d s\n", (rt_tick_get() - last_activity) / RT_TICK_PER_SECOND);
+    rt_kprintf("saved     : ~%d mWh/day vs. always full brightness (%d s sampled)\n",
+               saved_mwh_day, stat_ms / 1000);
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(disp_power_cmd, disp_power, show display power state or wake the display);
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         背光自适应与显示电源管理
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __DISP_POWER_H__
+#define __DISP_POWER_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 显示电源状态 */
+typedef enum {
+    DISP_POWER_ACTIVE = 0,      // 正常显示，背光随环境光调节
+    DISP_POWER_DIM,             // 无人活动，背光调暗
+    DISP_POWER_SLEEP            // 屏幕休眠，背光关闭，暂停绘制
+} disp_power_state_t;
+
+/**
+ * 初始化显示电源管理（打开背光PWM并启动管理线程）
+ *
+ * @param wake_hook 屏幕从休眠唤醒后调用，用于请求重绘，可为RT_NULL
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t disp_power_init(void (*wake_hook)(void));
+
+/**
+ * 输入环境光照度（由光照传感器线程调用）
+ *
+ * @param lux 照度
+ */
+void disp_power_lux(float lux);
+
+/**
+ * 报告有人活动（接近传感器检测到物体等），重新计时并唤醒屏幕
+ */
+void disp_power_activity(void);
+
+/**
+ * 按当前占空比重新设置背光PWM（系统时钟分频变化后调用，PWM驱动按新时钟重新计算分频）
+ */
+void disp_power_refresh(void);
+
+/**
+ * 查询屏幕是否处于可绘制状态
+ *
+ * @return 休眠时返回RT_FALSE
+ */
+rt_bool_t disp_power_is_on(void);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
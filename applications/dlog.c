@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         异步延迟日志
+ */
+
+#include "dlog.h"          // 异步日志头文件
+#include "mem_region.h"    // 多区域内存分配
+#include <board.h>         // DWT周期计数器
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DLOG_BUF_SIZE       4096    // 环形缓冲区大小
+#define DLOG_LINE_SIZE      256     // 文本模式单行最大长度
+#define DLOG_HDR_SIZE       12      // 记录头：级别、参数个数、字符串掩码、保留、tick、格式字符串地址
+#define DLOG_MAX_PAYLOAD    255     // 单条记录最大长度（长度字段为1字节）
+#define DLOG_SYNC0          0xA5    // 二进制帧同步字节
+#define DLOG_SYNC1          0x5A
+
+/*
+ * 环形缓冲区中每条记录为 [长度(1字节)][记录内容]，记录内容即二进制帧的负载：
+ *   0: 级别  1: 参数个数  2: 字符串参数掩码  3: 保留
+ *   4~7: tick（小端）  8~11: 格式字符串地址（小端）
+ *   之后依次为参数：整数4字节小端，字符串为1字节长度+内容（不含结尾'\0'）。
+ * 长度为0表示回绕标记，读取位置回到缓冲区开头。每条记录在缓冲区中连续存放。
+ *
+ * 二进制模式的帧格式为 A5 5A [长度] [负载] [校验和]，校验和为负载各字节之和的低8位。
+ * 帧之外的字节（rt_kprintf、msh回显）原样保留，tools/dlog_decode.py会把它们当作文本输出。
+ */
+
+static rt_uint8_t *ring = RT_NULL;          // 环形缓冲区
+static volatile rt_uint16_t head = 0;       // 写位置
+static volatile rt_uint16_t tail = 0;       // 读位置
+static struct rt_semaphore dlog_sem;        // 有新记录时通知输出线程
+static rt_bool_t binary_mode = RT_FALSE;    // 是否以二进制帧输出
+
+/* 统计 */
+static rt_uint32_t stat_records = 0;        // 写入的记录数
+static rt_uint32_t stat_drops = 0;          // 缓冲区满丢弃的记录数
+static rt_uint32_t stat_truncated = 0;      // 字符串被截断的记录数
+static rt_uint32_t stat_peak = 0;           // 缓冲区最大占用（字节）
+static rt_uint32_t write_ns_max = 0;        // dlog_write最大耗时（纳秒）
+static rt_uint64_t write_ns_sum = 0;        // dlog_write总耗时（纳秒）
+
+/**
+ * 解析格式字符串，得到每个参数是否为字符串
+ *
+ * @param fmt     格式字符串
+ * @param is_str  输出：各参数是否为字符串
+ * @return 参数个数
+ */
+static int dlog_parse(const char *fmt, rt_bool_t *is_str)
+{
+    int nargs = 0;
+
+    while (*fmt && nargs < DLOG_MAX_ARGS) {
+        if (*fmt++ != '%') {
+            continue;
+        }
+        if (*fmt == '%') {
+            fmt++;
+            continue;
+        }
+        /* 跳过标志、宽度、精度和长度修饰符，'*'宽度也占一个整数参数 */
+        while (*fmt && strchr("-+ #0123456789.*lhz", *fmt)) {
+            if (*fmt == '*' && nargs < DLOG_MAX_ARGS) {
+                is_str[nargs++] = RT_FALSE;
+            }
+            fmt++;
+        }
+        if (*fmt && nargs < DLOG_MAX_ARGS) {
+            is_str[nargs++] = (*fmt == 's');
+            fmt++;
+        }
+    }
+
+    return nargs;
+}
+
+/**
+ * 小端写入32位整数
+ */
+static void dlog_put32(rt_uint8_t *p, rt_uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+/**
+ * 小端读取32位整数
+ */
+static rt_uint32_t dlog_get32(const rt_uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((rt_uint32_t)p[3] << 24);
+}
+
+/**
+ * 在环形缓冲区中预留n字节的连续空间（调用时须已关中断）
+ *
+ * @return 空间起始位置，空间不足返回-1
+ */
+static int dlog_reserve(rt_uint16_t n)
+{
+    int pos;
+
+    if (head >= tail) {
+        if (DLOG_BUF_SIZE - head > n) {
+            pos = head;
+        } else if (tail > n) {
+            ring[head] = 0;  // 回绕标记
+            pos = 0;
+        } else {
+            return -1;
+        }
+    } else if (tail - head > n) {
+        pos = head;
+    } else {
+        return -1;
+    }
+
+    head = pos + n;
+    return pos;
+}
+
+/**
+ * 记录一条日志（只保存格式字符串地址和参数，由输出线程格式化/发送）
+ *
+ * @param level 日志级别
+ * @param fmt   格式字符串常量
+ */
+void dlog_write(rt_uint8_t level, const char *fmt, ...)
+{
+    rt_uint32_t start = DWT->CYCCNT;
+    rt_bool_t is_str[DLOG_MAX_ARGS];
+    rt_ubase_t vals[DLOG_MAX_ARGS];
+    rt_uint8_t lens[DLOG_MAX_ARGS];
+    rt_uint16_t len = DLOG_HDR_SIZE;
+    rt_uint8_t str_mask = 0;
+    rt_uint8_t *p;
+    rt_base_t irq;
+    int nargs, pos, i;
+    rt_uint32_t used, ns;
+    va_list args;
+
+    va_start(args, fmt);
+
+    /* 初始化之前直接同步输出 */
+    if (ring == RT_NULL) {
+        char line[DLOG_LINE_SIZE];
+
+        rt_vsnprintf(line, sizeof(line), fmt, args);
+        va_end(args);
+        rt_kputs(line);
+        return;
+    }
+
+    /* 取出参数并计算记录长度，超长的字符串被截断 */
+    nargs = dlog_parse(fmt, is_str);
+    for (i = 0; i < nargs; i++) {
+        if (is_str[i]) {
+            const char *s = va_arg(args, const char *);
+            rt_size_t slen = s ? rt_strlen(s) : 0;
+
+            if (slen > DLOG_MAX_PAYLOAD - 1 - len) {
+                slen = DLOG_MAX_PAYLOAD - 1 - len;
+                stat_truncated++;
+            }
+            vals[i] = (rt_ubase_t)s;
+            lens[i] = slen;
+            str_mask |= 1 << i;
+            len += 1 + slen;
+        } else {
+            vals[i] = va_arg(args, rt_ubase_t);
+            len += 4;
+            if (len > DLOG_MAX_PAYLOAD) {   // 只可能在字符串占满后出现，丢掉多余参数
+                len -= 4;
+                nargs = i;
+                break;
+            }
+        }
+    }
+    va_end(args);
+
+    irq = rt_hw_interrupt_disable();
+    pos = dlog_reserve(len + 1);
+    if (pos < 0) {
+        stat_drops++;
+        rt_hw_interrupt_enable(irq);
+        return;
+    }
+
+    p = &ring[pos];
+    *p++ = len;
+    p[0] = level;
+    p[1] = nargs;
+    p[2] = str_mask;
+    p[3] = 0;
+    dlog_put32(p + 4, rt_tick_get());
+    dlog_put32(p + 8, (rt_ubase_t)fmt);
+    p += DLOG_HDR_SIZE;
+    for (i = 0; i < nargs; i++) {
+        if (str_mask & (1 << i)) {
+            *p++ = lens[i];
+            rt_memcpy(p, (const void *)vals[i], lens[i]);
+            p += lens[i];
+        } else {
+            dlog_put32(p, vals[i]);
+            p += 4;
+        }
+    }
+
+    stat_records++;
+    used = (head + DLOG_BUF_SIZE - tail) % DLOG_BUF_SIZE;
+    if (used > stat_peak) {
+        stat_peak = used;
+    }
+    /* 按记录时的主频换算（与perf_record相同的理由），每周期的纳秒数取10位小数的定点数 */
+    ns = (rt_uint32_t)(((rt_uint64_t)(DWT->CYCCNT - start)
+                        * ((1000U << 10) / (SystemCoreClock / 1000000))) >> 10);
+    write_ns_sum += ns;
+    if (ns > write_ns_max) {
+        write_ns_max = ns;
+    }
+    rt_hw_interrupt_enable(irq);
+
+    rt_sem_release(&dlog_sem);
+}
+
+/**
+ * 以文本形式输出一条记录
+ */
+static void dlog_emit_text(const rt_uint8_t *rec, rt_uint8_t len)
+{
+    static char line[DLOG_LINE_SIZE];       // 格式化结果
+    static char strings[DLOG_MAX_PAYLOAD];  // 字符串参数（加上结尾'\0'）
+    rt_ubase_t argv[DLOG_MAX_ARGS] = {0};
+    const rt_uint8_t *p = rec + DLOG_HDR_SIZE;
+    char *s = strings;
+    int i;
+
+    for (i = 0; i < rec[1]; i++) {
+        if (rec[2] & (1 << i)) {
+            rt_memcpy(s, p + 1, p[0]);
+            s[p[0]] = '\0';
+            argv[i] = (rt_ubase_t)s;
+            s += p[0] + 1;
+            p += 1 + p[0];
+        } else {
+            argv[i] = dlog_get32(p);
+            p += 4;
+        }
+    }
+
+    /* 参数均为32位，按最大个数传入即可，多余的参数会被忽略 */
+    rt_snprintf(line, sizeof(line), (const char *)(rt_ubase_t)dlog_get32(rec + 8),
+                argv[0], argv[1], argv[2], argv[3], argv[4], argv[5]);
+    rt_kputs(line);
+}
+
+/**
+ * 以二进制帧输出一条记录
+ *
+ * 控制台以流模式打开，串口驱动会在每个0x0A前插入0x0D，长度、tick、参数或校验和中
+ * 含有0x0A的帧会被破坏。写帧期间清除流模式标志，结束后恢复；rt_kprintf每次输出时
+ * 自行设置并恢复该标志，期间被抢占也不受影响。
+ */
+static void dlog_emit_binary(const rt_uint8_t *rec, rt_uint8_t len)
+{
+    rt_device_t console = rt_console_get_device();
+    rt_uint8_t frame[3] = {DLOG_SYNC0, DLOG_SYNC1, len};
+    rt_uint8_t sum = 0;
+    rt_uint16_t old_flag;
+    int i;
+
+    if (console == RT_NULL) {
+        return;
+    }
+    for (i = 0; i < len; i++) {
+        sum += rec[i];
+    }
+    old_flag = console->open_flag;
+    console->open_flag &= ~RT_DEVICE_FLAG_STREAM;
+    rt_device_write(console, 0, frame, sizeof(frame));
+    rt_device_write(console, 0, rec, len);
+    rt_device_write(console, 0, &sum, 1);
+    console->open_flag = old_flag;
+}
+
+/**
+ * 输出缓冲区中的全部记录
+ */
+static void dlog_drain(void)
+{
+    rt_uint8_t len;
+    rt_base_t irq;
+
+    while (tail != head) {
+        len = ring[tail];
+        if (len == 0) {     // 回绕标记
+            tail = 0;
+            continue;
+        }
+
+        /* 记录所在空间在tail前移之前不会被覆盖，可以直接读取 */
+        if (binary_mode) {
+            dlog_emit_binary(&ring[tail + 1], len);
+        } else {
+            dlog_emit_text(&ring[tail + 1], len);
+        }
+
+        irq = rt_hw_interrupt_disable();
+        tail += 1 + len;
+        rt_hw_interrupt_enable(irq);
+    }
+}
+
+/**
+ * 输出线程：以最低优先级把缓冲区中的记录写到串口
+ *
+ * 串口发送的阻塞只发生在本线程，采集和上传线程写日志只需复制几十字节。
+ */
+static void dlog_thread_entry(void *parameter)
+{
+    while (1) {
+        rt_sem_take(&dlog_sem, RT_WAITING_FOREVER);
+        dlog_drain();
+    }
+}
+
+/**
+ * 初始化日志环形缓冲区并启动输出线程
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t dlog_init(void)
+{
+    rt_thread_t tid;  // 线程句柄
+
+    /* 缓冲区只由CPU访问，放在CCM中 */
+    ring = mem_region_alloc(MEM_HINT_FAST, DLOG_BUF_SIZE);
+    if (ring == RT_NULL) {
+        return -RT_ENOMEM;
+    }
+    rt_sem_init(&dlog_sem, "dlog", 0, RT_IPC_FLAG_PRIO);
+
+    tid = rt_thread_create("dlog", dlog_thread_entry, RT_NULL, 1024, RT_THREAD_PRIORITY_MAX - 2, 5);
+    if (tid == RT_NULL) {
+        return -RT_ENOMEM;
+    }
+
+    return rt_thread_startup(tid);
+}
+
+/**
+ * msh命令：查看统计、切换输出模式、对比同步输出的阻塞时间
+ *
+ * 用法：dlog [text|bin|bench [次数]]
+ * bin模式下串口输出二进制帧，用 python tools/dlog_decode.py rtthread.elf <串口或抓包文件> 解码；
+ * bench分别测量rt_kprintf和dlog_write输出一条上传URL长度的日志时调用者被阻塞的时间。
+ */
+static int dlog(int argc, char **argv)
+{
+    rt_uint32_t cycles_per_us = SystemCoreClock / 1000000;
+    rt_uint32_t start, sync_cycles, async_cycles;
+    const char *sample = "/upload?dev=1a2b3c4d&boot=5e6f7a8b&seq=123&age=1000&temp=25&humi=60&light=1234";
+    int rounds = 10, i;
+
+    if (argc > 1 && rt_strcmp(argv[1], "text") == 0) {
+        binary_mode = RT_FALSE;
+    } else if (argc > 1 && rt_strcmp(argv[1], "bin") == 0) {
+        binary_mode = RT_TRUE;
+    } else if (argc > 1 && rt_strcmp(argv[1], "bench") == 0) {
+        if (argc > 2 && atoi(argv[2]) > 0) {
+            rounds = atoi(argv[2]);
+        }
+
+        start = DWT->CYCCNT;
+        for (i = 0; i < rounds; i++) {
+            rt_kprintf("[HTTP] Uploading to: http://192.168.1.100:5000%s\n", sample);
+        }
+        sync_cycles = (DWT->CYCCNT - start) / rounds;
+
+        start = DWT->CYCCNT;
+        for (i = 0; i < rounds; i++) {
+            DLOG_I("[HTTP] Uploading to: http://192.168.1.100:5000%s\n", sample);
+        }
+        async_cycles = (DWT->CYCCNT - start) / rounds;
+
+        rt_kprintf("rt_kprintf: %d us/line, dlog: %d us/line\n",
+                   sync_cycles / cycles_per_us, async_cycles / cycles_per_us);
+        return 0;
+    }
+
+    rt_kprintf("mode: %s, level: %d\n", binary_mode ? "binary" : "text", DLOG_LEVEL);
+    rt_kprintf("records: %d, drops: %d, truncated: %d\n", stat_records, stat_drops, stat_truncated);
+    rt_kprintf("buffer: %d/%d bytes peak\n", stat_peak, DLOG_BUF_SIZE);
+    rt_kprintf("write: avg %d ns, max %d ns\n",
+               stat_records ? (rt_uint32_t)(write_ns_sum / stat_records) : 0, write_ns_max);
+
+    return 0;
+}
+MSH_CMD_EXPORT(dlog, deferred logger status: dlog [text|bin|bench [n]]);
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         异步延迟日志
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __DLOG_H__
+#define __DLOG_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 日志级别 */
+#define DLOG_LVL_ERROR      0
+#define DLOG_LVL_WARNING    1
+#define DLOG_LVL_INFO       2
+#define DLOG_LVL_DEBUG      3
+
+/* 编译期过滤：高于该级别的日志调用不产生任何代码 */
+#ifndef DLOG_LEVEL
+#define DLOG_LEVEL          DLOG_LVL_INFO
+#endif
+
+#define DLOG_MAX_ARGS       6       // 每条日志最多参数个数
+
+/*
+ * 日志宏，格式字符串必须是字符串常量（只保存其地址）。
+ * 参数只支持32位整数、字符和字符串（%d %u %x %c %s %p），
+ * 字符串在调用时复制，不支持浮点和64位整数。
+ */
+#if DLOG_LEVEL >= DLOG_LVL_ERROR
+#define DLOG_E(fmt, ...)    dlog_write(DLOG_LVL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define DLOG_E(fmt, ...)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LVL_WARNING
+#define DLOG_W(fmt, ...)    dlog_write(DLOG_LVL_WARNING, fmt, ##__VA_ARGS__)
+#else
+#define DLOG_W(fmt, ...)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LVL_INFO
+#define DLOG_I(fmt, ...)    dlog_write(DLOG_LVL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define DLOG_I(fmt, ...)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LVL_DEBUG
+#define DLOG_D(fmt, ...)    dlog_write(DLOG_LVL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define DLOG_D(fmt, ...)
+#endif
+
+/**
+ * 初始化日志环形缓冲区并启动输出线程
+ *
+ * 初始化之前的日志直接同步输出。
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t dlog_init(void);
+
+/**
+ * 记录一条日志（只保存格式字符串地址和参数，由输出线程格式化/发送）
+ *
+ * 缓冲区满时丢弃该条日志并计数，调用者不会被阻塞。
+ *
+ * @param level 日志级别
+ * @param fmt   格式字符串常量
+ */
+void dlog_write(rt_uint8_t level, const char *fmt, ...);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         LCD滚动趋势图
+ */
+
+#include "lcd_chart.h"  // 趋势图头文件
+#include "lcd_fb.h"     // 帧缓冲
+
+#ifdef LCD_USING_FRAMEBUFFER
+
+/**
+ * 把采样值换算为列高度（0~h-1，0为底部）
+ */
+static rt_uint8_t lcd_chart_level(struct lcd_chart *chart, float value)
+{
+    float ratio = (value - chart->min) / (chart->max - chart->min);
+
+    if (ratio < 0.0f) ratio = 0.0f;
+    if (ratio > 1.0f) ratio = 1.0f;
+
+    return (rt_uint8_t)(ratio * (chart->h - 1) + 0.5f);
+}
+
+/**
+ * 绘制一列：先填背景，再画从上一列高度到本列高度的竖线，使曲线连续
+ *
+ * 空列只画背景，空列之后的第一列不与之前的曲线相连。
+ *
+ * @param chart 趋势图
+ * @param col   屏幕上的列号（0~w-1）
+ * @param prev  上一列高度
+ * @param cur   本列高度
+ */
+static void lcd_chart_draw_column(struct lcd_chart *chart, rt_uint16_t col, rt_uint8_t prev, rt_uint8_t cur)
+{
+    rt_uint8_t lo, hi;                        // 竖线下端、上端
+    rt_uint16_t x = chart->x + col;           // 列的X坐标
+    rt_uint16_t bottom = chart->y + chart->h - 1;  // 图底部Y坐标
+
+    lcd_fb_fill(x, chart->y, 1, chart->h, chart->back);
+    if (cur == LCD_CHART_GAP) {
+        return;
+    }
+    if (prev == LCD_CHART_GAP) {
+        prev = cur;
+    }
+
+    lo = prev < cur ? prev : cur;
+    hi = prev < cur ? cur : prev;
+    lcd_fb_fill(x, bottom - hi, 1, hi - lo + 1, chart->fore);
+}
+
+/**
+ * 在历史数据末尾加入一列（需关中断），满w列后覆盖最旧的一列
+ */
+static void lcd_chart_push(struct lcd_chart *chart, rt_uint8_t level, float value)
+{
+    rt_uint16_t i;  // 新列的下标
+
+    if (chart->count == chart->w) {
+        i = chart->head;
+        chart->head = (chart->head + 1) % chart->w;
+    } else {
+        i = (chart->head + chart->count) % chart->w;
+        chart->count++;
+    }
+    chart->level[i] = level;
+    chart->value[i] = value;
+
+    if (chart->pending < chart->w) {
+        chart->pending++;
+    }
+}
+
+/**
+ * 结束所有已到时的列（需关中断）
+ *
+ * 当前列按已有采样取平均（没有采样则为空列），其后整个周期都没有采样的
+ * 列记为空列（最多一屏），结束时刻按周期对齐地跳到当前时刻之后。
+ */
+static void lcd_chart_advance(struct lcd_chart *chart, rt_tick_t now)
+{
+    rt_uint32_t periods;  // 已到时的列数
+    rt_uint32_t i;
+
+    if ((rt_int32_t)(now - chart->next) < 0) {
+        return;
+    }
+
+    periods = (now - chart->next) / chart->period + 1;
+    chart->next += periods * chart->period;
+
+    if (chart->samples) {
+        lcd_chart_push(chart, lcd_chart_level(chart, chart->sum / chart->samples), chart->sum / chart->samples);
+    } else {
+        lcd_chart_push(chart, LCD_CHART_GAP, 0.0f);
+    }
+    chart->sum = 0.0f;
+    chart->samples = 0;
+
+    for (i = 1; i < periods && i < chart->w; i++) {
+        lcd_chart_push(chart, LCD_CHART_GAP, 0.0f);
+    }
+}
+
+/**
+ * 复制历史数据（需关中断），按从旧到新的顺序排列，并求出非空列的最小、最大值
+ *
+ * @param range 输出[最小值, 最大值]，没有非空列时range[0] > range[1]
+ * @return 列数
+ */
+static rt_uint16_t lcd_chart_copy(struct lcd_chart *chart, rt_uint8_t *level, float *range)
+{
+    rt_uint16_t i, k;
+
+    range[0] = chart->max;
+    range[1] = chart->min - 1.0f;
+    for (i = 0; i < chart->count; i++) {
+        k = (chart->head + i) % chart->w;
+        level[i] = chart->level[k];
+        if (level[i] == LCD_CHART_GAP) {
+            continue;
+        }
+        if (range[1] < range[0]) {
+            range[0] = range[1] = chart->value[k];  // 第一个非空列
+        } else if (chart->value[k] < range[0]) {
+            range[0] = chart->value[k];
+        } else if (chart->value[k] > range[1]) {
+            range[1] = chart->value[k];
+        }
+    }
+
+    return chart->count;
+}
+
+/**
+ * 把刻度值格式化为不超过LCD_CHART_LABEL_CHARS个字符（四舍五入，绝对值达到1000时以k为单位）
+ */
+static void lcd_chart_format(char *buf, float value)
+{
+    int n = (int)(value < 0.0f ? value - 0.5f : value + 0.5f);  // 四舍五入后的整数
+
+    if (n >= 1000 || n <= -1000) {
+        rt_snprintf(buf, LCD_CHART_LABEL_CHARS + 1, "%dk", (n + (n < 0 ? -500 : 500)) / 1000);
+    } else {
+        rt_snprintf(buf, LCD_CHART_LABEL_CHARS + 1, "%d", n);
+    }
+}
+
+/**
+ * 绘制一个刻度（右对齐），与屏幕上的内容相同时不重绘
+ *
+ * @param chart 趋势图
+ * @param row   0为最大值（右上），1为最小值（右下）
+ * @param text  刻度文字（不超过LCD_CHART_LABEL_CHARS个字符），空串表示清除
+ * @param force 为真时总是重绘
+ * @return 帧缓冲有变化返回RT_TRUE
+ */
+static rt_bool_t lcd_chart_label(struct lcd_chart *chart, int row, const char *text, rt_bool_t force)
+{
+    rt_uint16_t x = chart->x + chart->w + LCD_CHART_LABEL_GAP;  // 刻度区域左边界
+    rt_uint16_t y = row ? chart->y + chart->h - LCD_FB_LABEL_H : chart->y;
+    rt_uint16_t len = rt_strlen(text);
+
+    if (!force && rt_strcmp(chart->label[row], text) == 0) {
+        return RT_FALSE;
+    }
+    rt_memcpy(chart->label[row], text, len + 1);
+
+    lcd_fb_fill(x, y, LCD_CHART_LABEL_CHARS * LCD_FB_LABEL_W, LCD_FB_LABEL_H, chart->back);
+    lcd_fb_label(x + (LCD_CHART_LABEL_CHARS - len) * LCD_FB_LABEL_W, y, text, chart->back, chart->fore);
+    return RT_TRUE;
+}
+
+/**
+ * 按图中数据的范围更新两个刻度
+ *
+ * 刻度颜色与曲线相同，文字取自数字字形缓存，缓存生成（lcd_glyph_cache_init）之前只清空刻度区域。
+ *
+ * @return 帧缓冲有变化返回RT_TRUE
+ */
+static rt_bool_t lcd_chart_labels(struct lcd_chart *chart, const float *range, rt_bool_t force)
+{
+    char hi[LCD_CHART_LABEL_CHARS + 1] = "", lo[LCD_CHART_LABEL_CHARS + 1] = "";
+    rt_bool_t changed;
+
+    if (range[0] <= range[1]) {
+        lcd_chart_format(hi, range[1]);
+        lcd_chart_format(lo, range[0]);
+    }
+
+    changed = lcd_chart_label(chart, 0, hi, force);
+    return lcd_chart_label(chart, 1, lo, force) || changed;
+}
+
+/**
+ * 绘制历史数据中从第from列开始的各列（数据靠右对齐），from为0时同时清空左侧空白
+ */
+static void lcd_chart_paint(struct lcd_chart *chart, const rt_uint8_t *level, rt_uint16_t count, rt_uint16_t from)
+{
+    rt_uint16_t start = chart->w - count;  // 第一列在屏幕上的位置
+    rt_uint16_t i;
+
+    if (from == 0) {
+        lcd_fb_fill(chart->x, chart->y, start, chart->h, chart->back);
+    }
+
+    for (i = from; i < count; i++) {
+        lcd_chart_draw_column(chart, start + i, i ? level[i - 1] : level[i], level[i]);
+    }
+}
+
+/**
+ * 初始化趋势图并绘制空白背景
+ */
+void lcd_chart_init(struct lcd_chart *chart, rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t h,
+                    float min, float max, rt_uint32_t span_ms, rt_uint16_t back, rt_uint16_t fore)
+{
+    rt_tick_t period = rt_tick_from_millisecond(span_ms / w);  // 每列代表的时间
+    rt_base_t level;  // 中断状态
+
+    RT_ASSERT(chart != RT_NULL);
+    RT_ASSERT(w > 1 && w <= LCD_CHART_MAX_W);
+    RT_ASSERT(h >= 2 * LCD_FB_LABEL_H && max > min);
+
+    /* 采样线程可能已在运行，period非零之前的采样会被忽略 */
+    level = rt_hw_interrupt_disable();
+    rt_memset(chart, 0, sizeof(*chart));
+    chart->x = x;
+    chart->y = y;
+    chart->w = w;
+    chart->h = h;
+    chart->min = min;
+    chart->max = max;
+    chart->back = back;
+    chart->fore = fore;
+    chart->next = rt_tick_get() + period;
+    chart->period = period;
+    rt_hw_interrupt_enable(level);
+
+    lcd_chart_redraw(chart);
+}
+
+/**
+ * 加入一个采样值（在采样线程中调用，不访问帧缓冲）
+ */
+void lcd_chart_sample(struct lcd_chart *chart, float value)
+{
+    rt_base_t level;  // 中断状态
+
+    RT_ASSERT(chart != RT_NULL);
+
+    level = rt_hw_interrupt_disable();
+    if (chart->period != 0) {
+        lcd_chart_advance(chart, rt_tick_get());
+        chart->sum += value;
+        chart->samples++;
+    }
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * 把尚未绘制的列画到帧缓冲（在显示线程中每帧调用）
+ */
+rt_bool_t lcd_chart_draw(struct lcd_chart *chart)
+{
+    rt_uint8_t level[LCD_CHART_MAX_W];  // 历史数据快照
+    float range[2];                     // 图中数据的最小、最大值
+    rt_uint16_t count, pending;         // 列数、新列数
+    rt_base_t irq;                      // 中断状态
+
+    RT_ASSERT(chart != RT_NULL);
+
+    irq = rt_hw_interrupt_disable();
+    lcd_chart_advance(chart, rt_tick_get());
+    pending = chart->pending;
+    chart->pending = 0;
+    count = lcd_chart_copy(chart, level, range);
+    rt_hw_interrupt_enable(irq);
+
+    if (pending == 0) {
+        return RT_FALSE;
+    }
+
+    if (pending >= count) {
+        lcd_chart_paint(chart, level, count, 0);
+    } else {
+        /* 帧缓冲中整体左移（DMA刷新该区域），只画最右侧的新列 */
+        lcd_fb_scroll_left(chart->x, chart->y, chart->w, chart->h, pending);
+        lcd_chart_paint(chart, level, count, count - pending);
+    }
+    lcd_chart_labels(chart, range, RT_FALSE);
+
+    return RT_TRUE;
+}
+
+/**
+ * 按保存的历史数据重绘整个趋势图
+ */
+void lcd_chart_redraw(struct lcd_chart *chart)
+{
+    rt_uint8_t level[LCD_CHART_MAX_W];  // 历史数据快照
+    float range[2];                     // 图中数据的最小、最大值
+    rt_uint16_t count;                  // 列数
+    rt_base_t irq;                      // 中断状态
+
+    RT_ASSERT(chart != RT_NULL);
+
+    irq = rt_hw_interrupt_disable();
+    chart->pending = 0;
+    count = lcd_chart_copy(chart, level, range);
+    rt_hw_interrupt_enable(irq);
+
+    lcd_chart_paint(chart, level, count, 0);
+    lcd_chart_labels(chart, range, RT_TRUE);
+}
+
+#endif /* LCD_USING_FRAMEBUFFER */
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         LCD滚动趋势图
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __LCD_CHART_H__
+#define __LCD_CHART_H__
+
+// RT核心头文件
+#include <rtthread.h>
+#include "lcd_fb.h"
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LCD_CHART_MAX_W  64   // 趋势图最大宽度（列数），决定每个图的历史数据内存
+#define LCD_CHART_GAP    0xFF // 整个周期内没有采样的列（屏幕休眠、传感器出错），只画背景
+
+/* 图右侧的刻度：图中数据的最大值（上）和最小值（下），用缩小的缓存字形绘制 */
+#define LCD_CHART_LABEL_CHARS  3     // 刻度最多字符数（超过1000以k为单位）
+#define LCD_CHART_LABEL_GAP    2     // 刻度与图之间的空隙（像素）
+#define LCD_CHART_LABEL_W      (LCD_CHART_LABEL_GAP + LCD_CHART_LABEL_CHARS * LCD_FB_LABEL_W)  // 刻度占用的宽度
+
+/*
+ * 一个向左滚动的趋势图：每列为一个周期内采样的平均值
+ *
+ * 采样（lcd_chart_sample）在传感器线程中进行，只更新历史数据；
+ * 绘制（lcd_chart_draw）在显示线程中进行，把尚未绘制的列画到帧缓冲，
+ * 刻度只在显示的最大/最小值变化时重绘。
+ * 两者之间只在关中断的短临界区内交换数据，可以在不同线程中调用。
+ */
+struct lcd_chart {
+    rt_uint16_t x, y, w, h;             // 绘图区域
+    float min, max;                     // 纵轴范围（固定，与网页仪表盘一致）
+    rt_uint16_t fore, back;             // 曲线颜色、背景色
+    rt_tick_t period;                   // 每列代表的时间（tick）
+    rt_tick_t next;                     // 当前列结束时刻
+    float sum;                          // 当前列采样值之和
+    rt_uint32_t samples;                // 当前列采样次数
+    rt_uint8_t level[LCD_CHART_MAX_W];  // 各列高度（环形，最多w列）
+    float value[LCD_CHART_MAX_W];       // 各列平均值（与level同下标，用于刻度）
+    rt_uint16_t head;                   // 最旧一列的下标
+    rt_uint16_t count;                  // 已有列数
+    rt_uint16_t pending;                // 已结束但尚未绘制的列数
+    char label[2][LCD_CHART_LABEL_CHARS + 1];  // 屏幕上的最大值、最小值刻度
+};
+
+/**
+ * 初始化趋势图并绘制空白背景
+ *
+ * 刻度画在图右侧，另占LCD_CHART_LABEL_W像素宽。
+ *
+ * @param chart     趋势图
+ * @param x         左上角X坐标
+ * @param y         左上角Y坐标
+ * @param w         宽度（不超过LCD_CHART_MAX_W，不含刻度）
+ * @param h         高度（不小于两行刻度的高度）
+ * @param min       纵轴下限
+ * @param max       纵轴上限
+ * @param span_ms   整个图覆盖的时间(ms)，每列代表span_ms/w
+ * @param back      背景色
+ * @param fore      曲线颜色
+ */
+void lcd_chart_init(struct lcd_chart *chart, rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t h,
+                    float min, float max, rt_uint32_t span_ms, rt_uint16_t back, rt_uint16_t fore);
+
+/**
+ * 加入一个采样值（在采样线程中调用，不访问帧缓冲）
+ *
+ * 先结束已到时的列：没有采样的周期记为空列，落后超过一个周期时
+ * 直接对齐到当前时刻，不会在之后逐帧补列。趋势图尚未初始化时忽略采样。
+ *
+ * @param chart 趋势图
+ * @param value 采样值
+ */
+void lcd_chart_sample(struct lcd_chart *chart, float value);
+
+/**
+ * 把尚未绘制的列画到帧缓冲（在显示线程中每帧调用）
+ *
+ * 新列少于已有列数时整体左移并只画新列，否则重绘整个趋势图；
+ * 刻度只在显示的最大/最小值变化时重绘。
+ * 采样中断（如传感器持续出错）时也会按时间推进空列。
+ *
+ * @param chart 趋势图
+ * @return 帧缓冲有变化返回RT_TRUE
+ */
+rt_bool_t lcd_chart_draw(struct lcd_chart *chart);
+
+/**
+ * 按保存的历史数据重绘整个趋势图（屏幕被覆盖后调用）
+ *
+ * @param chart 趋势图
+ */
+void lcd_chart_redraw(struct lcd_chart *chart);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
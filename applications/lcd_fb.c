@@ -0,0 +1,589 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         外部SRAM帧缓冲+DMA刷屏
+ */
+
+#include "lcd_fb.h"     // 帧缓冲头文件
+#include "lcd_glyph.h"  // 字形光栅化与缓存
+#include "mem_region.h"  // 多区域内存分配
+#include <board.h>      // HAL库
+#include <drv_lcd.h>    // LCD驱动（窗口设置）
+#include <stdlib.h>
+
+#define LCD_FB_DMA_TIMEOUT    100         // 单次刷新超时(ms)
+
+/* 240x240 RGB565帧缓冲（112.5KB），初始化时从外部SRAM堆分配；初始化失败时保持为空 */
+static rt_uint16_t (*lcd_fb)[LCD_W] = RT_NULL;
+
+/* 脏矩形（闭区间），dirty为假时无待刷新内容 */
+static rt_bool_t dirty = RT_FALSE;
+static rt_uint16_t dirty_x1, dirty_y1, dirty_x2, dirty_y2;
+
+/* DMA2数据流0做存储器到存储器传输：源地址递增，目标固定为LCD数据口 */
+static DMA_HandleTypeDef fb_dma;
+static struct rt_semaphore fb_done;       // 一次刷新全部完成
+static struct rt_mutex fb_lock;           // 保护DMA通道
+static rt_uint16_t blit_row, blit_end;    // 正在传输的行、最后一行
+static rt_uint16_t blit_x, blit_w;        // 传输区域起始列、宽度
+static volatile rt_bool_t blit_error;     // 本次刷新中DMA是否出错
+
+/* 统计数据 */
+static rt_uint32_t flush_count = 0;       // 刷新次数
+static rt_uint32_t flush_pixels = 0;      // 累计刷新像素数
+
+/**
+ * 把矩形并入脏区域
+ */
+static void lcd_fb_mark(rt_uint16_t x1, rt_uint16_t y1, rt_uint16_t x2, rt_uint16_t y2)
+{
+    if (!dirty) {
+        dirty_x1 = x1;
+        dirty_y1 = y1;
+        dirty_x2 = x2;
+        dirty_y2 = y2;
+        dirty = RT_TRUE;
+        return;
+    }
+
+    if (x1 < dirty_x1) dirty_x1 = x1;
+    if (y1 < dirty_y1) dirty_y1 = y1;
+    if (x2 > dirty_x2) dirty_x2 = x2;
+    if (y2 > dirty_y2) dirty_y2 = y2;
+}
+
+/**
+ * 裁剪矩形到屏幕范围内
+ *
+ * @return 裁剪后为空或帧缓冲不可用返回RT_FALSE
+ */
+static rt_bool_t lcd_fb_clip(rt_uint16_t x, rt_uint16_t y, rt_uint16_t *w, rt_uint16_t *h)
+{
+    if (lcd_fb == RT_NULL || x >= LCD_W || y >= LCD_H || *w == 0 || *h == 0) {
+        return RT_FALSE;
+    }
+    if (x + *w > LCD_W) *w = LCD_W - x;
+    if (y + *h > LCD_H) *h = LCD_H - y;
+
+    return RT_TRUE;
+}
+
+/**
+ * DMA传输完成回调（中断上下文）：整宽区域一次传完，否则逐行续传
+ */
+static void lcd_fb_dma_done(DMA_HandleTypeDef *hdma)
+{
+    if (++blit_row <= blit_end) {
+        HAL_DMA_Start_IT(hdma, (rt_uint32_t)&lcd_fb[blit_row][blit_x], LCD_DATA_ADDR, blit_w);
+    } else {
+        rt_sem_release(&fb_done);
+    }
+}
+
+/**
+ * DMA传输出错回调（中断上下文）：停止续传并标记错误，由等待方决定如何处理
+ */
+static void lcd_fb_dma_error(DMA_HandleTypeDef *hdma)
+{
+    blit_row = blit_end;
+    blit_error = RT_TRUE;
+    rt_sem_release(&fb_done);
+}
+
+/**
+ * DMA2数据流0中断服务函数
+ */
+void DMA2_Stream0_IRQHandler(void)
+{
+    rt_interrupt_enter();
+    HAL_DMA_IRQHandler(&fb_dma);
+    rt_interrupt_leave();
+}
+
+/**
+ * 初始化帧缓冲（填充背景色）和DMA通道
+ *
+ * @param color 背景色
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t lcd_fb_init(rt_uint16_t color)
+{
+    void *buf;  // 帧缓冲，DMA就绪后才交给lcd_fb
+
+    /* 先建锁：lcd_fb非空时其他线程即可调用lcd_fb_lock() */
+    rt_sem_init(&fb_done, "fb_done", 0, RT_IPC_FLAG_PRIO);
+    rt_mutex_init(&fb_lock, "fb_lock", RT_IPC_FLAG_PRIO);
+
+    buf = mem_region_alloc(MEM_HINT_LARGE, sizeof(rt_uint16_t) * LCD_W * LCD_H);
+    if (buf == RT_NULL) {
+        rt_kprintf("[FB] No memory for framebuffer\n");
+        return -RT_ENOMEM;
+    }
+
+    __HAL_RCC_DMA2_CLK_ENABLE();
+    fb_dma.Instance = DMA2_Stream0;
+    fb_dma.Init.Channel = DMA_CHANNEL_0;
+    fb_dma.Init.Direction = DMA_MEMORY_TO_MEMORY;
+    fb_dma.Init.PeriphInc = DMA_PINC_ENABLE;            // 源：帧缓冲，逐像素递增
+    fb_dma.Init.MemInc = DMA_MINC_DISABLE;              // 目标：LCD数据口，地址固定
+    fb_dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    fb_dma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    fb_dma.Init.Mode = DMA_NORMAL;
+    fb_dma.Init.Priority = DMA_PRIORITY_LOW;
+    fb_dma.Init.FIFOMode = DMA_FIFOMODE_ENABLE;         // 存储器到存储器模式必须使用FIFO
+    fb_dma.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+    fb_dma.Init.MemBurst = DMA_MBURST_SINGLE;
+    fb_dma.Init.PeriphBurst = DMA_PBURST_SINGLE;
+    if (HAL_DMA_Init(&fb_dma) != HAL_OK) {
+        rt_kprintf("[FB] DMA init failed\n");
+        mem_region_free(buf);
+        return -RT_ERROR;
+    }
+    fb_dma.XferCpltCallback = lcd_fb_dma_done;
+    fb_dma.XferErrorCallback = lcd_fb_dma_error;
+
+    HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+
+    lcd_fb = buf;
+    lcd_fb_fill(0, 0, LCD_W, LCD_H, color);
+    return RT_EOK;
+}
+
+/**
+ * 帧缓冲是否可用
+ */
+rt_bool_t lcd_fb_ready(void)
+{
+    return lcd_fb != RT_NULL;
+}
+
+/**
+ * 在帧缓冲中填充矩形
+ */
+void lcd_fb_fill(rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t h, rt_uint16_t color)
+{
+    rt_uint16_t i, j;
+
+    if (!lcd_fb_clip(x, y, &w, &h)) {
+        return;
+    }
+
+    for (j = 0; j < h; j++) {
+        rt_uint16_t *row = &lcd_fb[y + j][x];
+        for (i = 0; i < w; i++) {
+            row[i] = color;
+        }
+    }
+    lcd_fb_mark(x, y, x + w - 1, y + h - 1);
+}
+
+/**
+ * 在帧缓冲中画水平线
+ */
+void lcd_fb_hline(rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t color)
+{
+    lcd_fb_fill(x, y, w, 1, color);
+}
+
+/**
+ * 把RGB565图片（高字节在前）拷贝到帧缓冲
+ */
+void lcd_fb_image(rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t h, const rt_uint8_t *p)
+{
+    rt_uint16_t i, j;
+    rt_uint16_t src_w = w;  // 裁剪前的图片宽度（源数据行跨度）
+
+    if (!lcd_fb_clip(x, y, &w, &h)) {
+        return;
+    }
+
+    for (j = 0; j < h; j++) {
+        const rt_uint8_t *src = p + (rt_uint32_t)j * src_w * 2;
+        rt_uint16_t *row = &lcd_fb[y + j][x];
+        for (i = 0; i < w; i++) {
+            row[i] = (src[2 * i] << 8) | src[2 * i + 1];
+        }
+    }
+    lcd_fb_mark(x, y, x + w - 1, y + h - 1);
+}
+
+/**
+ * 在帧缓冲中绘制字符串
+ */
+rt_err_t lcd_fb_string(rt_uint16_t x, rt_uint16_t y, rt_uint32_t size, const char *str,
+                       rt_uint16_t back, rt_uint16_t fore)
+{
+    rt_uint16_t cw = size / 2;       // 字符宽度
+    rt_uint16_t x0 = x;              // 起始X坐标
+    const rt_uint16_t *sprite;       // 缓存的字形
+    rt_uint16_t r;
+
+    if (lcd_fb == RT_NULL) {
+        return -RT_ERROR;
+    }
+    if (size != 16 && size != 24) {
+        return -RT_EINVAL;
+    }
+
+    for (; *str != '\0' && x + cw <= LCD_W && y + size <= LCD_H; str++, x += cw) {
+        /* 数字等常变字符直接拷贝CCM中预渲染的字形，其余字符现场光栅化 */
+        sprite = (size == LCD_GLYPH_SIZE) ? lcd_glyph_cached(*str, back, fore) : RT_NULL;
+        if (sprite != RT_NULL) {
+            for (r = 0; r < size; r++) {
+                rt_memcpy(&lcd_fb[y + r][x], sprite + r * cw, cw * sizeof(rt_uint16_t));
+            }
+        } else {
+            lcd_glyph_render(*str, size, back, fore, &lcd_fb[y][x], LCD_W);
+        }
+    }
+
+    if (x > x0) {
+        lcd_fb_mark(x0, y, x - 1, y + size - 1);
+    }
+    return RT_EOK;
+}
+
+/**
+ * 用缓存的字形按一半大小在帧缓冲中绘制字符串
+ *
+ * 缓存字形只作为形状，按指定颜色重新着色。每2x2个像素中有一个是笔画即画为前景色，
+ * 24点阵约2像素宽的笔画缩小后不会断开。
+ */
+rt_bool_t lcd_fb_label(rt_uint16_t x, rt_uint16_t y, const char *str, rt_uint16_t back, rt_uint16_t fore)
+{
+    const rt_uint16_t *sprite;   // 缓存的字形
+    const rt_uint16_t *src;      // 源像素（2x2块的左上角）
+    rt_uint16_t ink;             // 缓存字形的笔画颜色
+    rt_uint16_t x0 = x;          // 起始X坐标
+    rt_uint16_t r, c;
+    const char *p;
+
+    if (lcd_fb == RT_NULL || y + LCD_FB_LABEL_H > LCD_H) {
+        return RT_FALSE;
+    }
+    /* 先确认全部命中，避免画到一半 */
+    for (p = str; *p != '\0'; p++) {
+        if (lcd_glyph_shape(*p, &ink) == RT_NULL) {
+            return RT_FALSE;
+        }
+    }
+
+    for (p = str; *p != '\0' && x + LCD_FB_LABEL_W <= LCD_W; p++, x += LCD_FB_LABEL_W) {
+        sprite = lcd_glyph_shape(*p, &ink);
+        for (r = 0; r < LCD_FB_LABEL_H; r++) {
+            for (c = 0; c < LCD_FB_LABEL_W; c++) {
+                /* 从第1行开始取块，跳过字形最上一行 */
+                src = sprite + (2 * r + 1) * LCD_GLYPH_W + 2 * c;
+                lcd_fb[y + r][x + c] = (src[0] == ink || src[1] == ink
+                                        || src[LCD_GLYPH_W] == ink || src[LCD_GLYPH_W + 1] == ink) ? fore : back;
+            }
+        }
+    }
+
+    if (x > x0) {
+        lcd_fb_mark(x0, y, x - 1, y + LCD_FB_LABEL_H - 1);
+    }
+    return RT_TRUE;
+}
+
+/* 解码到帧缓冲时的写位置 */
+struct lcd_fb_rle_ctx {
+    rt_uint16_t x0, x1;   // 图片左右边界（闭区间）
+    rt_uint16_t x, y;     // 下一个像素的位置
+};
+
+/**
+ * 解码回调：把像素写入帧缓冲，到达图片右边界后换行
+ */
+static void lcd_fb_rle_span(void *ctx, const rt_uint8_t *px, rt_uint16_t count, rt_bool_t repeat)
+{
+    struct lcd_fb_rle_ctx *pos = (struct lcd_fb_rle_ctx *)ctx;
+    rt_uint16_t color = (px[0] << 8) | px[1];
+
+    while (count--) {
+        if (!repeat) {
+            color = (px[0] << 8) | px[1];
+            px += 2;
+        }
+        lcd_fb[pos->y][pos->x] = color;
+        if (pos->x++ == pos->x1) {
+            pos->x = pos->x0;
+            pos->y++;
+        }
+    }
+}
+
+/**
+ * 把逐行RLE编码的图片解码到帧缓冲
+ */
+rt_err_t lcd_fb_rle_image(rt_uint16_t x, rt_uint16_t y, const struct lcd_rle_image *img)
+{
+    struct lcd_fb_rle_ctx pos;  // 写位置
+
+    if (lcd_fb == RT_NULL) {
+        return -RT_ERROR;
+    }
+    if (x + img->width > LCD_W || y + img->height > LCD_H) {
+        return -RT_EINVAL;
+    }
+
+    pos.x0 = pos.x = x;
+    pos.x1 = x + img->width - 1;
+    pos.y = y;
+    lcd_fb_mark(x, y, x + img->width - 1, y + img->height - 1);
+
+    return lcd_rle_decode(img, lcd_fb_rle_span, &pos);
+}
+
+/**
+ * 把帧缓冲中的矩形区域整体左移n列
+ */
+void lcd_fb_scroll_left(rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t h, rt_uint16_t n)
+{
+    rt_uint16_t j;
+
+    if (!lcd_fb_clip(x, y, &w, &h) || n >= w) {
+        return;
+    }
+
+    for (j = 0; j < h; j++) {
+        rt_memmove(&lcd_fb[y + j][x], &lcd_fb[y + j][x + n], (w - n) * sizeof(rt_uint16_t));
+    }
+    lcd_fb_mark(x, y, x + w - 1, y + h - 1);
+}
+
+/**
+ * 通过DMA把帧缓冲中的矩形写到屏幕，传输完成后返回
+ *
+ * 调用方需持有fb_lock。
+ *
+ * @return 成功返回RT_EOK，DMA出错返回-RT_EIO，超时返回-RT_ETIMEOUT
+ */
+static rt_err_t lcd_fb_blit(rt_uint16_t x1, rt_uint16_t y1, rt_uint16_t x2, rt_uint16_t y2)
+{
+    rt_uint32_t count;  // 首次传输的像素数
+
+    lcd_address_set(x1, y1, x2, y2);
+
+    blit_x = x1;
+    blit_w = x2 - x1 + 1;
+    if (blit_w == LCD_W) {
+        /* 整宽区域在帧缓冲中连续，一次传完（240x240=57600，未超过65535） */
+        blit_row = y2;
+        blit_end = y2;
+        count = (rt_uint32_t)blit_w * (y2 - y1 + 1);
+    } else {
+        blit_row = y1;
+        blit_end = y2;
+        count = blit_w;
+    }
+
+    rt_sem_control(&fb_done, RT_IPC_CMD_RESET, RT_NULL);
+    blit_error = RT_FALSE;
+    if (HAL_DMA_Start_IT(&fb_dma, (rt_uint32_t)&lcd_fb[y1][x1], LCD_DATA_ADDR, count) != HAL_OK) {
+        return -RT_EBUSY;
+    }
+    if (rt_sem_take(&fb_done, rt_tick_from_millisecond(LCD_FB_DMA_TIMEOUT)) != RT_EOK) {
+        HAL_DMA_Abort(&fb_dma);
+        return -RT_ETIMEOUT;
+    }
+    if (blit_error) {
+        return -RT_EIO;
+    }
+
+    flush_count++;
+    flush_pixels += (rt_uint32_t)blit_w * (y2 - y1 + 1);
+    return RT_EOK;
+}
+
+/**
+ * 把自上次刷新以来的脏矩形通过DMA写到屏幕，传输完成后返回
+ *
+ * 刷新失败时该矩形重新并入脏区域，下次刷新时重传。
+ *
+ * @return 成功返回RT_EOK，DMA出错返回-RT_EIO，超时返回-RT_ETIMEOUT，
+ *         帧缓冲不可用返回-RT_ERROR
+ */
+rt_err_t lcd_fb_flush(void)
+{
+    rt_err_t result = RT_EOK;  // 返回值
+    rt_uint16_t x1, y1, x2, y2;
+
+    if (lcd_fb == RT_NULL) {
+        return -RT_ERROR;
+    }
+    rt_mutex_take(&fb_lock, RT_WAITING_FOREVER);
+    if (dirty) {
+        x1 = dirty_x1;
+        y1 = dirty_y1;
+        x2 = dirty_x2;
+        y2 = dirty_y2;
+        dirty = RT_FALSE;
+        result = lcd_fb_blit(x1, y1, x2, y2);
+        if (result != RT_EOK) {
+            lcd_fb_mark(x1, y1, x2, y2);
+        }
+    }
+    rt_mutex_release(&fb_lock);
+
+    return result;
+}
+
+/**
+ * 独占LCD总线，等待正在进行的刷新完成
+ *
+ * 其他线程向屏幕发命令（休眠/唤醒等）前调用，避免命令插入DMA传输的像素流中。
+ * 帧缓冲未初始化时没有DMA传输，直接返回。
+ */
+void lcd_fb_lock(void)
+{
+    if (lcd_fb != RT_NULL) {
+        rt_mutex_take(&fb_lock, RT_WAITING_FOREVER);
+    }
+}
+
+/**
+ * 释放lcd_fb_lock()占用的LCD总线
+ */
+void lcd_fb_unlock(void)
+{
+    if (lcd_fb != RT_NULL) {
+        rt_mutex_release(&fb_lock);
+    }
+}
+
+/**
+ * msh命令：整屏刷新基准测试
+ *
+ * 用法：fb_bench [帧数]
+ * 分别用CPU逐像素写和DMA传输把当前帧缓冲整屏刷新N次，
+ * 统计帧率以及CPU实际占用比例（DMA等待期间CPU可运行其他线程）。
+ */
+static int fb_bench(int argc, char **argv)
+{
+    int frames = 50;                    // 测试帧数
+    int i;
+    rt_uint32_t start, total, busy;     // 周期计数
+    rt_uint32_t cycles_per_us = SystemCoreClock / 1000000;
+    rt_uint32_t fps10;                  // 帧率x10
+    rt_uint32_t x, y;
+
+    if (lcd_fb == RT_NULL) {
+        rt_kprintf("[FB] Framebuffer not initialized\n");
+        return -RT_ERROR;
+    }
+
+    if (argc > 1) {
+        frames = atoi(argv[1]);
+    }
+    if (frames <= 0) {
+        frames = 1;
+    }
+
+    rt_mutex_take(&fb_lock, RT_WAITING_FOREVER);
+
+    /* CPU逐像素写屏（原绘制方式），CPU全程占用 */
+    start = DWT->CYCCNT;
+    for (i = 0; i < frames; i++) {
+        lcd_address_set(0, 0, LCD_W - 1, LCD_H - 1);
+        for (y = 0; y < LCD_H; y++) {
+            for (x = 0; x < LCD_W; x++) {
+                *(volatile rt_uint16_t *)LCD_DATA_ADDR = lcd_fb[y][x];
+            }
+        }
+    }
+    total = DWT->CYCCNT - start;
+    fps10 = (rt_uint32_t)((rt_uint64_t)frames * 10000000 / (total / cycles_per_us));
+    rt_kprintf("cpu blit: %d.%d fps, cpu 100%%\n", fps10 / 10, fps10 % 10);
+
+    /* DMA整屏传输，只统计启动传输所用的CPU时间 */
+    busy = 0;
+    start = DWT->CYCCNT;
+    for (i = 0; i < frames; i++) {
+        rt_uint32_t t0 = DWT->CYCCNT;
+
+        lcd_address_set(0, 0, LCD_W - 1, LCD_H - 1);
+        blit_x = 0;
+        blit_w = LCD_W;
+        blit_row = blit_end = LCD_H - 1;
+        rt_sem_control(&fb_done, RT_IPC_CMD_RESET, RT_NULL);
+        blit_error = RT_FALSE;
+        if (HAL_DMA_Start_IT(&fb_dma, (rt_uint32_t)&lcd_fb[0][0], LCD_DATA_ADDR, LCD_W * LCD_H) != HAL_OK) {
+            break;
+        }
+        busy += DWT->CYCCNT - t0;
+        if (rt_sem_take(&fb_done, rt_tick_from_millisecond(LCD_FB_DMA_TIMEOUT)) != RT_EOK) {
+            HAL_DMA_Abort(&fb_dma);
+            break;
+        }
+        if (blit_error) {
+            break;
+        }
+    }
+    total = DWT->CYCCNT - start;
+    if (i < frames) {
+        rt_mutex_release(&fb_lock);
+        rt_kprintf("dma blit: failed at frame %d (%s)\n", i, blit_error ? "dma error" : "timeout or busy");
+        return -RT_EIO;
+    }
+    fps10 = (rt_uint32_t)((rt_uint64_t)frames * 10000000 / (total / cycles_per_us));
+    rt_kprintf("dma blit: %d.%d fps, cpu %d%%\n", fps10 / 10, fps10 % 10,
+               (int)((rt_uint64_t)busy * 100 / total));
+
+    rt_mutex_release(&fb_lock);
+
+    rt_kprintf("dirty flushes: %d, avg %d px\n", flush_count,
+               flush_count ? flush_pixels / flush_count : 0);
+    return 0;
+}
+MSH_CMD_EXPORT(fb_bench, benchmark full-screen CPU vs DMA framebuffer blit);
+
+/**
+ * msh命令：以PPM(P3)文本格式输出帧缓冲中的区域
+ *
+ * 用法：fb_ppm [x y w h]，默认整屏。
+ * 在串口终端中记录输出，截取"P3"开始的部分另存为.ppm即可在PC上查看，
+ * 无需拍摄屏幕即可检查绘制结果。
+ */
+static int fb_ppm(int argc, char **argv)
+{
+    rt_uint16_t x = 0, y = 0, w = LCD_W, h = LCD_H;  // 输出区域
+    rt_uint16_t i, j;
+
+    if (lcd_fb == RT_NULL) {
+        rt_kprintf("[FB] Framebuffer not initialized\n");
+        return -RT_ERROR;
+    }
+
+    if (argc == 5) {
+        x = atoi(argv[1]);
+        y = atoi(argv[2]);
+        w = atoi(argv[3]);
+        h = atoi(argv[4]);
+    } else if (argc != 1) {
+        rt_kprintf("usage: fb_ppm [x y w h]\n");
+        return -1;
+    }
+    if (!lcd_fb_clip(x, y, &w, &h)) {
+        rt_kprintf("empty region\n");
+        return -1;
+    }
+
+    rt_kprintf("P3\n%d %d\n255\n", w, h);
+    for (j = 0; j < h; j++) {
+        for (i = 0; i < w; i++) {
+            rt_uint16_t c = lcd_fb[y + j][x + i];
+            /* RGB565展开为8位分量 */
+            rt_kprintf("%d %d %d ", (c >> 11) * 255 / 31, ((c >> 5) & 0x3F) * 255 / 63, (c & 0x1F) * 255 / 31);
+        }
+        rt_kprintf("\n");
+    }
+
+    return 0;
+}
+MSH_CMD_EXPORT(fb_ppm, dump a framebuffer region as PPM text);
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         外部SRAM帧缓冲+DMA刷屏
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __LCD_FB_H__
+#define __LCD_FB_H__
+
+// RT核心头文件
+#include <rtthread.h>
+#include "lcd_rle.h"
+#include "lcd_glyph.h"
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * 定义LCD_USING_FRAMEBUFFER（menuconfig: PhytoLink Application）后文本层绘制到外部SRAM帧缓冲，
+ * 再以脏矩形为单位通过DMA刷新到屏幕。lcd_fb_init()失败时lcd_fb_ready()为假，
+ * 绘制函数不做任何事，调用方应改为直接在屏幕上绘制。
+ */
+
+/*
+ * 屏幕挂在FSMC Bank1 NE4，RS接A6：16位总线下写0x6C00007E为命令，
+ * 写0x6C000080为显存数据。lcd_address_set()设置窗口并发出写显存命令后，
+ * 按行顺序写入窗口内的像素即可。
+ */
+#define LCD_DATA_ADDR         ((rt_uint32_t)0x6C000080)
+
+/* lcd_fb_label()的字符大小：缓存字形缩小一半，去掉最上一行和最下一行空白 */
+#define LCD_FB_LABEL_W        (LCD_GLYPH_W / 2)
+#define LCD_FB_LABEL_H        ((LCD_GLYPH_SIZE - 2) / 2)
+
+/**
+ * 初始化帧缓冲（填充背景色）和DMA通道
+ *
+ * @param color 背景色
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t lcd_fb_init(rt_uint16_t color);
+
+/**
+ * 帧缓冲是否可用
+ *
+ * @return lcd_fb_init()成功后返回RT_TRUE
+ */
+rt_bool_t lcd_fb_ready(void);
+
+/**
+ * 在帧缓冲中填充矩形
+ *
+ * @param x     左上角X坐标
+ * @param y     左上角Y坐标
+ * @param w     宽度
+ * @param h     高度
+ * @param color 填充颜色
+ */
+void lcd_fb_fill(rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t h, rt_uint16_t color);
+
+/**
+ * 在帧缓冲中画水平线
+ *
+ * @param x     起点X坐标
+ * @param y     Y坐标
+ * @param w     长度
+ * @param color 颜色
+ */
+void lcd_fb_hline(rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t color);
+
+/**
+ * 把RGB565图片（高字节在前，与lcd_show_image格式相同）拷贝到帧缓冲
+ *
+ * @param x 左上角X坐标
+ * @param y 左上角Y坐标
+ * @param w 图片宽度
+ * @param h 图片高度
+ * @param p 图片数据
+ */
+void lcd_fb_image(rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t h, const rt_uint8_t *p);
+
+/**
+ * 在帧缓冲中绘制字符串
+ *
+ * @param x    左上角X坐标
+ * @param y    左上角Y坐标
+ * @param size 字号（16/24）
+ * @param str  字符串
+ * @param back 背景色
+ * @param fore 前景色
+ * @return 成功返回RT_EOK，字号不支持返回-RT_EINVAL
+ */
+rt_err_t lcd_fb_string(rt_uint16_t x, rt_uint16_t y, rt_uint32_t size, const char *str,
+                       rt_uint16_t back, rt_uint16_t fore);
+
+/**
+ * 用缓存的字形按一半大小在帧缓冲中绘制字符串（每个字符LCD_FB_LABEL_W x LCD_FB_LABEL_H）
+ *
+ * 用于趋势图刻度等小字，只支持LCD_GLYPH_CHARSET中的字符，缓存字形按指定颜色重新着色。
+ *
+ * @param x    左上角X坐标
+ * @param y    左上角Y坐标
+ * @param str  字符串
+ * @param back 背景色
+ * @param fore 前景色
+ * @return 全部字符命中缓存并已绘制返回RT_TRUE，否则不绘制并返回RT_FALSE
+ */
+rt_bool_t lcd_fb_label(rt_uint16_t x, rt_uint16_t y, const char *str, rt_uint16_t back, rt_uint16_t fore);
+
+/**
+ * 把逐行RLE编码的图片解码到帧缓冲
+ *
+ * @param x   左上角X坐标
+ * @param y   左上角Y坐标
+ * @param img 图片
+ * @return 成功返回RT_EOK，超出屏幕或数据错误返回错误码
+ */
+rt_err_t lcd_fb_rle_image(rt_uint16_t x, rt_uint16_t y, const struct lcd_rle_image *img);
+
+/**
+ * 把帧缓冲中的矩形区域整体左移n列，右侧空出的列保持原内容（由调用方重绘）
+ *
+ * @param x 左上角X坐标
+ * @param y 左上角Y坐标
+ * @param w 宽度
+ * @param h 高度
+ * @param n 左移列数
+ */
+void lcd_fb_scroll_left(rt_uint16_t x, rt_uint16_t y, rt_uint16_t w, rt_uint16_t h, rt_uint16_t n);
+
+/**
+ * 把自上次刷新以来的脏矩形通过DMA写到屏幕，传输完成后返回
+ *
+ * @return 成功返回RT_EOK，超时返回-RT_ETIMEOUT
+ */
+rt_err_t lcd_fb_flush(void);
+
+/**
+ * 独占LCD总线，等待正在进行的刷新完成
+ *
+ * 其他线程直接向屏幕发命令（如lcd_enter_sleep）前调用，与lcd_fb_unlock()成对使用。
+ */
+void lcd_fb_lock(void);
+
+/**
+ * 释放lcd_fb_lock()占用的LCD总线
+ */
+void lcd_fb_unlock(void);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         字形光栅化与数字字形缓存
+ */
+
+#include "lcd_glyph.h"  // 字形头文件
+#include "lcd_fb.h"     // LCD数据口地址
+#include <drv_lcd.h>    // LCD驱动（窗口设置）
+#include <string.h>
+
+/* 字库位于drv_lcd的lcdfont.h：逐行存储，高位在前，每行(size/2+7)/8字节 */
+extern const rt_uint8_t asc2_1608[];
+extern const rt_uint8_t asc2_2412[];
+
+#define LCD_GLYPH_COUNT   (sizeof(LCD_GLYPH_CHARSET) - 1)  // 缓存字形个数
+
+/*
+ * 预渲染的字形（15个x576字节，约8.4KB）放在CCM RAM：
+ * CCM只连接在D总线上，CPU读取零等待且不与DMA争用总线。
+ */
+static rt_uint16_t glyph_cache[LCD_GLYPH_COUNT][LCD_GLYPH_SIZE * LCD_GLYPH_W] RT_SECTION(".ccmram");
+static rt_uint16_t cache_back, cache_fore;   // 缓存字形的颜色
+static rt_bool_t cache_valid = RT_FALSE;     // 缓存是否已生成
+
+/**
+ * 把一个字符光栅化为RGB565像素
+ */
+rt_err_t lcd_glyph_render(char ch, rt_uint32_t size, rt_uint16_t back, rt_uint16_t fore,
+                          rt_uint16_t *dst, rt_uint16_t stride)
+{
+    const rt_uint8_t *font;                 // 字库
+    const rt_uint8_t *glyph;                // 字符点阵
+    rt_uint16_t cw = size / 2;              // 字符宽度
+    rt_uint16_t row_bytes = (cw + 7) / 8;   // 每行字节数
+    rt_uint16_t r, c;
+
+    switch (size) {
+    case 16: font = asc2_1608; break;
+    case 24: font = asc2_2412; break;
+    default: return -RT_EINVAL;
+    }
+
+    if (ch < ' ' || ch > '~') {
+        ch = ' ';
+    }
+    glyph = font + (rt_uint32_t)(ch - ' ') * size * row_bytes;
+
+    for (r = 0; r < size; r++, dst += stride) {
+        for (c = 0; c < cw; c++) {
+            rt_uint8_t bits = glyph[r * row_bytes + c / 8];
+            dst[c] = (bits & (0x80 >> (c % 8))) ? fore : back;
+        }
+    }
+
+    return RT_EOK;
+}
+
+/**
+ * 按指定颜色预渲染数字字形
+ */
+void lcd_glyph_cache_init(rt_uint16_t back, rt_uint16_t fore)
+{
+    rt_uint32_t i;
+
+    for (i = 0; i < LCD_GLYPH_COUNT; i++) {
+        lcd_glyph_render(LCD_GLYPH_CHARSET[i], LCD_GLYPH_SIZE, back, fore, glyph_cache[i], LCD_GLYPH_W);
+    }
+    cache_back = back;
+    cache_fore = fore;
+    cache_valid = RT_TRUE;
+}
+
+/**
+ * 查询缓存的字形
+ */
+const rt_uint16_t *lcd_glyph_cached(char ch, rt_uint16_t back, rt_uint16_t fore)
+{
+    const char *pos;  // 字符在字符集中的位置
+
+    if (!cache_valid || back != cache_back || fore != cache_fore || ch == '\0') {
+        return RT_NULL;
+    }
+
+    pos = strchr(LCD_GLYPH_CHARSET, ch);
+    return pos ? glyph_cache[pos - LCD_GLYPH_CHARSET] : RT_NULL;
+}
+
+/**
+ * 查询缓存的字形，不要求颜色一致
+ */
+const rt_uint16_t *lcd_glyph_shape(char ch, rt_uint16_t *fore)
+{
+    const char *pos;  // 字符在字符集中的位置
+
+    if (!cache_valid || ch == '\0') {
+        return RT_NULL;
+    }
+
+    pos = strchr(LCD_GLYPH_CHARSET, ch);
+    *fore = cache_fore;
+    return pos ? glyph_cache[pos - LCD_GLYPH_CHARSET] : RT_NULL;
+}
+
+/**
+ * 用缓存的字形把字符串直接写到LCD窗口
+ */
+rt_bool_t lcd_glyph_show(rt_uint16_t x, rt_uint16_t y, const char *str, rt_uint16_t back, rt_uint16_t fore)
+{
+    volatile rt_uint16_t *port = (volatile rt_uint16_t *)LCD_DATA_ADDR;  // LCD数据口
+    const char *p;
+    rt_uint32_t i;
+
+    /* 先确认全部命中，避免画到一半才退回光栅化 */
+    for (p = str; *p != '\0'; p++) {
+        if (lcd_glyph_cached(*p, back, fore) == RT_NULL) {
+            return RT_FALSE;
+        }
+    }
+
+    for (p = str; *p != '\0' && x + LCD_GLYPH_W <= LCD_W; p++, x += LCD_GLYPH_W) {
+        const rt_uint16_t *px = lcd_glyph_cached(*p, back, fore);
+
+        lcd_address_set(x, y, x + LCD_GLYPH_W - 1, y + LCD_GLYPH_SIZE - 1);
+        for (i = 0; i < LCD_GLYPH_SIZE * LCD_GLYPH_W; i++) {
+            *port = px[i];
+        }
+    }
+
+    return RT_TRUE;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         字形光栅化与数字字形缓存
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __LCD_GLYPH_H__
+#define __LCD_GLYPH_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LCD_GLYPH_SIZE     24                   // 缓存字形的字号
+#define LCD_GLYPH_W        (LCD_GLYPH_SIZE / 2) // 缓存字形宽度
+#define LCD_GLYPH_CHARSET  "0123456789 -.%k"    // 缓存的字符（数值字段中会变化的字符、趋势图刻度的k）
+
+/**
+ * 把一个字符光栅化为RGB565像素
+ *
+ * @param ch     字符
+ * @param size   字号（16/24）
+ * @param back   背景色
+ * @param fore   前景色
+ * @param dst    输出缓冲区
+ * @param stride 输出缓冲区每行像素数
+ * @return 成功返回RT_EOK，字号不支持返回-RT_EINVAL
+ */
+rt_err_t lcd_glyph_render(char ch, rt_uint32_t size, rt_uint16_t back, rt_uint16_t fore,
+                          rt_uint16_t *dst, rt_uint16_t stride);
+
+/**
+ * 按指定颜色预渲染数字字形（放在CCM RAM中）
+ *
+ * @param back 背景色
+ * @param fore 前景色
+ */
+void lcd_glyph_cache_init(rt_uint16_t back, rt_uint16_t fore);
+
+/**
+ * 查询缓存的字形
+ *
+ * @param ch   字符
+ * @param back 背景色
+ * @param fore 前景色
+ * @return 字形像素（LCD_GLYPH_W x LCD_GLYPH_SIZE），未缓存返回RT_NULL
+ */
+const rt_uint16_t *lcd_glyph_cached(char ch, rt_uint16_t back, rt_uint16_t fore);
+
+/**
+ * 查询缓存的字形，不要求颜色一致（按形状重新着色时使用）
+ *
+ * @param ch   字符
+ * @param fore 输出缓存字形的前景色，像素等于该值即为笔画
+ * @return 字形像素（LCD_GLYPH_W x LCD_GLYPH_SIZE），未缓存返回RT_NULL
+ */
+const rt_uint16_t *lcd_glyph_shape(char ch, rt_uint16_t *fore);
+
+/**
+ * 用缓存的字形把字符串直接写到LCD窗口
+ *
+ * @param x    左上角X坐标
+ * @param y    左上角Y坐标
+ * @param str  字符串
+ * @param back 背景色
+ * @param fore 前景色
+ * @return 全部字符命中缓存并已绘制返回RT_TRUE，否则不绘制并返回RT_FALSE
+ */
+rt_bool_t lcd_glyph_show(rt_uint16_t x, rt_uint16_t y, const char *str, rt_uint16_t back, rt_uint16_t fore);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         RLE压缩图片解码
+ */
+
+#include "lcd_rle.h"    // RLE图片头文件
+#include "lcd_fb.h"     // LCD数据口地址
+#include <drv_lcd.h>    // LCD驱动（窗口设置）
+
+/**
+ * 按顺序解码整幅图片，每段像素通过回调输出
+ *
+ * @param img  图片
+ * @param span 输出回调
+ * @param ctx  用户参数
+ * @return 成功返回RT_EOK，数据损坏返回-RT_ERROR
+ */
+rt_err_t lcd_rle_decode(const struct lcd_rle_image *img, lcd_rle_span_t span, void *ctx)
+{
+    const rt_uint8_t *p = img->data;              // 读指针
+    const rt_uint8_t *end = img->data + img->size; // 数据末尾
+    rt_uint32_t remain = (rt_uint32_t)img->width * img->height;  // 剩余像素数
+    rt_uint16_t count;                            // 本段像素数
+
+    while (remain > 0) {
+        if (p >= end) {
+            return -RT_ERROR;
+        }
+
+        count = (*p & 0x7F) + 1;
+        if (count > remain) {
+            return -RT_ERROR;
+        }
+
+        if (*p++ & 0x80) {
+            if (p + 2 > end) {
+                return -RT_ERROR;
+            }
+            span(ctx, p, count, RT_TRUE);
+            p += 2;
+        } else {
+            if (p + count * 2 > end) {
+                return -RT_ERROR;
+            }
+            span(ctx, p, count, RT_FALSE);
+            p += count * 2;
+        }
+        remain -= count;
+    }
+
+    return RT_EOK;
+}
+
+/**
+ * 解码回调：把像素写入LCD数据口
+ */
+static void lcd_rle_span_panel(void *ctx, const rt_uint8_t *px, rt_uint16_t count, rt_bool_t repeat)
+{
+    volatile rt_uint16_t *port = (volatile rt_uint16_t *)LCD_DATA_ADDR;  // LCD数据口
+    rt_uint16_t color;
+
+    if (repeat) {
+        color = (px[0] << 8) | px[1];
+        while (count--) {
+            *port = color;
+        }
+    } else {
+        while (count--) {
+            *port = (px[0] << 8) | px[1];
+            px += 2;
+        }
+    }
+}
+
+/**
+ * 把图片直接解码到LCD窗口
+ *
+ * 先设置图片大小的窗口，屏幕控制器按行自动换行，
+ * 解码出的像素依次写入数据口即可，无需行缓冲。
+ *
+ * @param x   左上角X坐标
+ * @param y   左上角Y坐标
+ * @param img 图片
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t lcd_rle_show(rt_uint16_t x, rt_uint16_t y, const struct lcd_rle_image *img)
+{
+    RT_ASSERT(img != RT_NULL);
+
+    if (x + img->width > LCD_W || y + img->height > LCD_H) {
+        return -RT_EINVAL;
+    }
+
+    lcd_address_set(x, y, x + img->width - 1, y + img->height - 1);
+    return lcd_rle_decode(img, lcd_rle_span_panel, RT_NULL);
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         RLE压缩图片解码
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __LCD_RLE_H__
+#define __LCD_RLE_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * 逐行RLE编码的RGB565图片（由tools/img2rle.py生成）
+ *
+ * 控制字节最高位为1：后跟1个像素，重复(低7位+1)次；
+ * 最高位为0：后跟(低7位+1)个原样像素。像素高字节在前。
+ */
+struct lcd_rle_image {
+    rt_uint16_t width;          // 宽度
+    rt_uint16_t height;         // 高度
+    const rt_uint8_t *data;     // 编码数据
+    rt_uint32_t size;           // 编码数据长度
+};
+
+/**
+ * 解码回调：输出一段像素
+ *
+ * @param ctx    用户参数
+ * @param px     像素数据（高字节在前）
+ * @param count  像素个数
+ * @param repeat 为真时px只有1个像素，重复count次
+ */
+typedef void (*lcd_rle_span_t)(void *ctx, const rt_uint8_t *px, rt_uint16_t count, rt_bool_t repeat);
+
+/**
+ * 按顺序解码整幅图片，每段像素通过回调输出
+ *
+ * @param img  图片
+ * @param span 输出回调
+ * @param ctx  用户参数
+ * @return 成功返回RT_EOK，数据损坏返回-RT_ERROR
+ */
+rt_err_t lcd_rle_decode(const struct lcd_rle_image *img, lcd_rle_span_t span, void *ctx);
+
+/**
+ * 把图片直接解码到LCD窗口，不需要整幅图片大小的缓冲区
+ *
+ * @param x   左上角X坐标
+ * @param y   左上角Y坐标
+ * @param img 图片
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t lcd_rle_show(rt_uint16_t x, rt_uint16_t y, const struct lcd_rle_image *img);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
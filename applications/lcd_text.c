@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         LCD文本增量刷新层
+ */
+
+#include "lcd_text.h"  // LCD文本层头文件
+#include <board.h>     // DWT周期计数器
+#include <drv_lcd.h>   // LCD驱动
+#include "lcd_fb.h"    // 帧缓冲
+#include "lcd_glyph.h" // 数字字形缓存
+#include <string.h>
+
+#define LCD_TEXT_STAT_PERIOD  5000  // 统计窗口长度(ms)
+
+static rt_bool_t full_redraw = RT_FALSE;  // 为真时退回整行重绘（用于对比测试）
+
+/* 绘制耗时统计：drv_lcd通过FSMC逐像素写屏，CPU在绘制函数中的时间即总线占用时间 */
+static rt_uint32_t stat_us = 0;           // 当前窗口内绘制耗时(us)
+static rt_uint32_t stat_chars = 0;        // 当前窗口内绘制的字符数
+static rt_uint32_t stat_calls = 0;        // 当前窗口内调用lcd_show_string的次数
+static rt_tick_t stat_start = 0;          // 当前窗口起始时刻
+static rt_uint32_t last_us_per_sec = 0;   // 上一窗口每秒绘制耗时(us)
+static rt_uint32_t last_chars_per_sec = 0;// 上一窗口每秒绘制字符数
+static rt_uint32_t last_calls_per_sec = 0;// 上一窗口每秒调用次数
+
+/**
+ * 启用DWT周期计数器
+ */
+static void lcd_text_cycle_init(void)
+{
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/**
+ * 累计一次绘制的统计数据，窗口结束时换算为每秒数值
+ *
+ * 周期数按绘制时的主频换算成微秒再累计，窗口内切换过clock_scale档位时不会按窗口结束时的主频误算。
+ *
+ * @param cycles 本次绘制耗费的CPU周期
+ * @param chars  本次绘制的字符数
+ */
+static void lcd_text_account(rt_uint32_t cycles, rt_uint32_t chars)
+{
+    rt_uint32_t cycles_per_us = SystemCoreClock / 1000000;  // 当前主频下每微秒的周期数
+    rt_tick_t elapsed;  // 当前窗口已持续的tick数
+
+    stat_us += (cycles + cycles_per_us / 2) / cycles_per_us;
+    stat_chars += chars;
+    stat_calls++;
+
+    elapsed = rt_tick_get() - stat_start;
+    if (elapsed >= rt_tick_from_millisecond(LCD_TEXT_STAT_PERIOD)) {
+        last_us_per_sec = (rt_uint32_t)((rt_uint64_t)stat_us * RT_TICK_PER_SECOND / elapsed);
+        last_chars_per_sec = stat_chars * RT_TICK_PER_SECOND / elapsed;
+        last_calls_per_sec = stat_calls * RT_TICK_PER_SECOND / elapsed;
+        stat_us = 0;
+        stat_chars = 0;
+        stat_calls = 0;
+        stat_start = rt_tick_get();
+    }
+}
+
+/**
+ * 绘制字符串中的一段连续字符
+ *
+ * @param text  文本字段
+ * @param str   完整字符串
+ * @param start 起始字符下标
+ * @param len   字符数
+ */
+static void lcd_text_draw_run(struct lcd_text *text, const char *str, int start, int len)
+{
+    char run[LCD_TEXT_MAX_LEN + 1];  // 待绘制的连续字符
+    rt_uint32_t begin;               // 绘制起始周期数
+
+    rt_memcpy(run, str + start, len);
+    run[len] = '\0';
+
+    begin = DWT->CYCCNT;
+#ifdef LCD_USING_FRAMEBUFFER
+    if (lcd_fb_ready()) {
+        /* 绘制到帧缓冲，由调用方在一帧结束后调用lcd_fb_flush() */
+        lcd_fb_string(text->x + start * (text->size / 2), text->y, text->size, run,
+                      text->back, text->fore);
+        lcd_text_account(DWT->CYCCNT - begin, len);
+        return;
+    }
+#endif
+    /* 数字等字符全部命中字形缓存时直接写窗口，否则交给驱动光栅化 */
+    if (text->size != LCD_GLYPH_SIZE
+            || !lcd_glyph_show(text->x + start * (text->size / 2), text->y, run, text->back, text->fore)) {
+        lcd_show_string(text->x + start * (text->size / 2), text->y, text->size, "%s", run);
+    }
+    lcd_text_account(DWT->CYCCNT - begin, len);
+}
+
+/**
+ * 初始化文本字段
+ *
+ * @param text 文本字段
+ * @param x    左上角X坐标
+ * @param y    左上角Y坐标
+ * @param size 字号
+ */
+void lcd_text_init(struct lcd_text *text, rt_uint16_t x, rt_uint16_t y, rt_uint8_t size)
+{
+    RT_ASSERT(text != RT_NULL);
+
+    lcd_text_cycle_init();
+    if (stat_start == 0) {
+        stat_start = rt_tick_get();
+    }
+
+    rt_memset(text, 0, sizeof(*text));
+    text->x = x;
+    text->y = y;
+    text->size = size;
+    text->valid = RT_FALSE;
+}
+
+/**
+ * 更新文本字段内容，只把变化的字符单元推送到屏幕
+ *
+ * @param text 文本字段
+ * @param str  新的字符串
+ * @param back 背景色
+ * @param fore 前景色
+ */
+void lcd_text_update(struct lcd_text *text, const char *str, rt_uint16_t back, rt_uint16_t fore)
+{
+    char next[LCD_TEXT_MAX_LEN + 1];  // 补齐空格后的新内容
+    int len, old_len, width;          // 新长度、旧长度、需比较的宽度
+    int i, run_start;                 // 当前下标、变化段起点
+
+    RT_ASSERT(text != RT_NULL);
+    RT_ASSERT(str != RT_NULL);
+
+    rt_strncpy(next, str, LCD_TEXT_MAX_LEN);
+    next[LCD_TEXT_MAX_LEN] = '\0';
+    len = rt_strlen(next);
+    old_len = text->valid ? rt_strlen(text->shown) : 0;
+
+    /* 新内容较短时用空格覆盖旧字符 */
+    width = len > old_len ? len : old_len;
+    for (i = len; i < width; i++) {
+        next[i] = ' ';
+    }
+    next[width] = '\0';
+
+    lcd_set_color(back, fore);
+
+    if (full_redraw || !text->valid || back != text->back || fore != text->fore) {
+        text->back = back;
+        text->fore = fore;
+        if (width > 0) {
+            lcd_text_draw_run(text, next, 0, width);
+        }
+    } else {
+        /* 逐字符比较，把相邻的变化字符合并为一次绘制 */
+        run_start = -1;
+        for (i = 0; i <= width; i++) {
+            rt_bool_t changed = (i < width) && (i >= old_len || next[i] != text->shown[i]);
+
+            if (changed && run_start < 0) {
+                run_start = i;
+            } else if (!changed && run_start >= 0) {
+                lcd_text_draw_run(text, next, run_start, i - run_start);
+                run_start = -1;
+            }
+        }
+    }
+
+    /* 末尾的填充空格已经擦除，记录时去掉 */
+    next[len] = '\0';
+    rt_strncpy(text->shown, next, sizeof(text->shown));
+    text->back = back;
+    text->fore = fore;
+    text->valid = RT_TRUE;
+}
+
+/**
+ * 标记字段失效，下次更新时整行重绘
+ *
+ * @param text 文本字段
+ */
+void lcd_text_invalidate(struct lcd_text *text)
+{
+    RT_ASSERT(text != RT_NULL);
+    text->valid = RT_FALSE;
+}
+
+/**
+ * msh命令：查看/切换LCD文本刷新方式
+ *
+ * 用法：lcd_stat [full|diff]
+ * full为每次整行重绘（原方式），diff为只重绘变化字符，切换后等待一个统计窗口再查看。
+ */
+static int lcd_stat(int argc, char **argv)
+{
+    if (argc > 1) {
+        if (rt_strcmp(argv[1], "full") == 0) {
+            full_redraw = RT_TRUE;
+        } else if (rt_strcmp(argv[1], "diff") == 0) {
+            full_redraw = RT_FALSE;
+        } else {
+            rt_kprintf("usage: lcd_stat [full|diff]\n");
+            return -1;
+        }
+    }
+
+    rt_kprintf("mode         : %s\n", full_redraw ? "full redraw" : "changed glyphs only");
+    rt_kprintf("bus time     : %d us/s\n", last_us_per_sec);
+    rt_kprintf("glyphs drawn : %d /s\n", last_chars_per_sec);
+    rt_kprintf("draw calls   : %d /s\n", last_calls_per_sec);
+
+    return 0;
+}
+MSH_CMD_EXPORT(lcd_stat, show LCD text bus time or switch full/diff redraw);
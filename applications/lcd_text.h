@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         LCD文本增量刷新层
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __LCD_TEXT_H__
+#define __LCD_TEXT_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LCD_TEXT_MAX_LEN  20   // 单个字段最多字符数（240像素/12像素字宽）
+
+/* 一个保留模式的文本字段：记住上次显示的内容，只重绘变化的字符 */
+struct lcd_text {
+    rt_uint16_t x;                      // 左上角X坐标
+    rt_uint16_t y;                      // 左上角Y坐标
+    rt_uint8_t size;                    // 字号（12/16/24/32）
+    rt_uint16_t back;                   // 上次绘制使用的背景色
+    rt_uint16_t fore;                   // 上次绘制使用的前景色
+    rt_bool_t valid;                    // 屏幕内容是否与shown一致
+    char shown[LCD_TEXT_MAX_LEN + 1];   // 屏幕上当前显示的字符串
+};
+
+/**
+ * 初始化文本字段
+ *
+ * @param text 文本字段
+ * @param x    左上角X坐标
+ * @param y    左上角Y坐标
+ * @param size 字号
+ */
+void lcd_text_init(struct lcd_text *text, rt_uint16_t x, rt_uint16_t y, rt_uint8_t size);
+
+/**
+ * 更新文本字段内容，只把变化的字符单元推送到屏幕
+ *
+ * 颜色变化时整行重绘；新字符串比原来短时用空格擦除多余字符。
+ *
+ * @param text 文本字段
+ * @param str  新的字符串
+ * @param back 背景色
+ * @param fore 前景色
+ */
+void lcd_text_update(struct lcd_text *text, const char *str, rt_uint16_t back, rt_uint16_t fore);
+
+/**
+ * 标记字段失效，下次更新时整行重绘（屏幕被其他代码覆盖后调用）
+ *
+ * @param text 文本字段
+ */
+void lcd_text_invalidate(struct lcd_text *text);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         无节拍低功耗空闲（STOP模式+RTC唤醒）
+ */
+
+#include "lowpower.h"      // 低功耗空闲头文件
+#include "lowpower_tick.h" // 节拍补偿换算
+#include <rtdevice.h>      // PIN设备
+#include <board.h>         // HAL库（RTC、PWR）
+#include "disp_power.h"    // 屏幕是否休眠
+#include "clock_scale.h"   // 唤醒后恢复当前档位的时钟
+#include "cpu_mon.h"       // 睡眠时长计入空闲线程
+#include "wifi_cache.h"    // 空闲时擦除写满的参数扇区
+#include "upload_queue.h"  // 有待上传记录时不擦除
+
+#ifndef RT_USING_IDLE_HOOK
+#error "lowpower requires RT_USING_IDLE_HOOK"
+#endif
+
+#define LP_MIN_STOP_MS      10          // 可睡眠时长小于该值时只执行WFI
+#define LP_WAKE_MARGIN_MS   3           // 提前唤醒，留出HSE/PLL重新起振的时间
+#define LP_MAX_STOP_MS      30000       // 单次STOP最长时间（唤醒定时器16位，2048Hz下约32秒）
+#define LP_CONSOLE_HOLD_MS  10000       // 控制台收到字符后多久内不进入STOP
+#define LP_REANCHOR_MS      (12 * 3600 * 1000)  // 超过该时间未读RTC则重新对齐（RTC按天回绕）
+
+#define LP_WUT_HZ           2048        // 唤醒定时器时钟：LSE 32768Hz / 16
+#define LP_CONSOLE_RX_PIN   GET_PIN(A, 10)  // USART1 RX，兼作STOP模式下的EXTI唤醒源
+
+/* 功耗估算参数（MCU本身，3.3V，参考数据手册典型值，不含屏幕和WiFi模块） */
+#define LP_RUN_UA           60000       // 运行（168MHz，外设开启）
+#define LP_SLEEP_UA         30000       // WFI睡眠
+#define LP_STOP_UA          500         // STOP（低功耗稳压器）
+#define LP_VDD_MV           3300
+
+/* 不能进入STOP的原因 */
+enum {
+    LP_VETO_NONE = 0,
+    LP_VETO_OFF,                // 被msh命令关闭
+    LP_VETO_SHORT,              // 距下一个定时器到期太近
+    LP_VETO_CONSOLE,            // 控制台正在使用（STOP期间串口收不到字符）
+    LP_VETO_DISPLAY,            // 屏幕亮着（STOP会停掉背光PWM）
+    LP_VETO_UART,               // 串口还在发送
+    LP_VETO_MAX
+};
+
+static const char *veto_names[LP_VETO_MAX] = {
+    "stop", "off", "short", "console", "display", "uart tx"
+};
+
+static RTC_HandleTypeDef hrtc;
+static rt_bool_t lp_enabled = RT_TRUE;
+static volatile rt_tick_t console_activity;
+
+/*
+ * 节拍补偿以RTC为基准：记录一对同时刻的(节拍, RTC时间)作为锚点，每次从STOP醒来
+ * 都按RTC经过的时间重新计算节拍，而不是把每次睡眠的估算时长累加上去，
+ * 因此RTC的1/256秒量化误差和唤醒后时钟恢复的耗时不会随睡眠次数累积。
+ */
+static rt_uint32_t rtc_last;            // 上次读到的RTC时间（1/256秒，一天内）
+static rt_uint64_t rtc_abs;             // 展开天回绕后的RTC时间
+static rt_uint64_t rtc_anchor;          // 锚点RTC时间
+static rt_tick_t tick_anchor;           // 锚点节拍
+static rt_tick_t rtc_read_tick;         // 上次读RTC时的节拍
+static rt_bool_t anchored = RT_FALSE;
+
+/* 统计 */
+static rt_tick_t stat_start;            // 统计起点
+static rt_uint64_t stop_ticks;          // STOP累计时长（节拍）
+static rt_uint64_t wfi_us;              // WFI累计时长（微秒）
+static rt_uint32_t stop_wakes;          // STOP唤醒次数
+static rt_uint32_t wfi_wakes;           // WFI唤醒次数
+static rt_uint32_t flash_erases;        // 空闲时擦除参数扇区的次数
+static rt_uint32_t vetoes[LP_VETO_MAX]; // 各原因导致只执行WFI的次数
+
+/**
+ * 读取RTC时间（1/256秒，一天内）
+ */
+static rt_uint32_t lowpower_rtc_read(void)
+{
+    RTC_TimeTypeDef time;
+    RTC_DateTypeDef date;
+
+    HAL_RTC_GetTime(&hrtc, &time, RTC_FORMAT_BIN);
+    HAL_RTC_GetDate(&hrtc, &date, RTC_FORMAT_BIN);  // 读日期寄存器解除影子寄存器锁定
+    return (time.Hours * 3600UL + time.Minutes * 60UL + time.Seconds) * LP_RTC_SUBSEC
+           + (time.SecondFraction - time.SubSeconds);
+}
+
+/**
+ * 读取RTC并展开天回绕
+ */
+static rt_uint64_t lowpower_rtc_now(void)
+{
+    rt_uint32_t raw = lowpower_rtc_read();
+
+    rtc_abs += lowpower_day_delta(rtc_last, raw);
+    rtc_last = raw;
+    rtc_read_tick = rt_tick_get();
+    return rtc_abs;
+}
+
+/**
+ * 检查当前能否进入STOP
+ *
+ * @param sleep 距下一个定时器到期的节拍数
+ * @return 可以进入时返回LP_VETO_NONE
+ */
+static int lowpower_veto(rt_tick_t sleep)
+{
+    if (!lp_enabled) {
+        return LP_VETO_OFF;
+    }
+    if (sleep < rt_tick_from_millisecond(LP_MIN_STOP_MS)) {
+        return LP_VETO_SHORT;
+    }
+    if (rt_tick_get() - console_activity < rt_tick_from_millisecond(LP_CONSOLE_HOLD_MS)) {
+        return LP_VETO_CONSOLE;
+    }
+    if (disp_power_is_on()) {
+        return LP_VETO_DISPLAY;
+    }
+    if (!(USART1->SR & USART_SR_TC)) {
+        return LP_VETO_UART;
+    }
+    return LP_VETO_NONE;
+}
+
+/**
+ * 进入STOP直到RTC唤醒或其他EXTI中断，醒来后恢复时钟并补偿节拍（调用时已关中断）
+ */
+static void lowpower_stop(rt_tick_t sleep)
+{
+    rt_uint32_t counts;
+    rt_tick_t now = rt_tick_get();
+    rt_tick_t expected;
+    rt_bool_t stale;
+
+    if (sleep > rt_tick_from_millisecond(LP_MAX_STOP_MS)) {
+        sleep = rt_tick_from_millisecond(LP_MAX_STOP_MS);
+    }
+    sleep -= rt_tick_from_millisecond(LP_WAKE_MARGIN_MS);
+    counts = (rt_uint64_t)sleep * LP_WUT_HZ / RT_TICK_PER_SECOND;
+
+    /*
+     * 首次睡眠、长时间未读RTC（天回绕无法判断）、或RTC时间被修改过（msh date，
+     * 锚点推算的节拍与实际相差超过1秒）时重新对齐锚点
+     */
+    stale = !anchored || now - rtc_read_tick > rt_tick_from_millisecond(LP_REANCHOR_MS);
+    lowpower_rtc_now();
+    expected = lowpower_expected_tick(tick_anchor, rtc_anchor, rtc_abs);
+    if (stale || (rt_int32_t)(expected - now) > RT_TICK_PER_SECOND || (rt_int32_t)(now - expected) > RT_TICK_PER_SECOND) {
+        rtc_anchor = rtc_abs;
+        tick_anchor = now;
+        anchored = RT_TRUE;
+    }
+
+    HAL_RTCEx_SetWakeUpTimer_IT(&hrtc, counts - 1, RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+    HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+
+    /* STOP唤醒后系统时钟为HSI，重新开启HSE和PLL并恢复当前档位的分频 */
+    clock_scale_resume();
+    HAL_RTCEx_DeactivateWakeUpTimer(&hrtc);
+
+    /* STOP期间影子寄存器不更新，须等待重新同步后再读 */
+    __HAL_RTC_WRITEPROTECTION_DISABLE(&hrtc);
+    HAL_RTC_WaitForSynchro(&hrtc);
+    __HAL_RTC_WRITEPROTECTION_ENABLE(&hrtc);
+
+    expected = lowpower_expected_tick(tick_anchor, rtc_anchor, lowpower_rtc_now());
+    now = rt_tick_get();
+    if ((rt_int32_t)(expected - now) > 0) {
+        rt_tick_set(expected);
+        stop_ticks += expected - now;
+        /* STOP期间DWT周期计数器停止，睡眠时长要另外计入空闲线程 */
+        cpu_mon_idle_credit((rt_uint64_t)(expected - now) * 1000000 / RT_TICK_PER_SECOND);
+    }
+    stop_wakes++;
+
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    /* 处理睡眠期间到期的定时器 */
+    rt_timer_check();
+}
+
+/**
+ * 擦除写满的WiFi缓存扇区，按RTC补偿停顿期间丢失的节拍（调用时已关中断）
+ *
+ * 擦除期间CPU停顿1~2秒，SysTick中断最多挂起一次，其余节拍丢失；RTC不受影响。
+ * 补偿后清除挂起的节拍中断，否则会多计一个节拍。
+ */
+static void lowpower_flash_erase(void)
+{
+    rt_tick_t before = rt_tick_get();
+    rt_uint64_t rtc_before = lowpower_rtc_now();
+    rt_tick_t expected;
+
+    wifi_cache_flush();
+
+    expected = lowpower_expected_tick(before, rtc_before, lowpower_rtc_now());
+    if ((rt_int32_t)(expected - rt_tick_get()) > 0) {
+        SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+        rt_tick_set(expected);
+    }
+    flash_erases++;
+}
+
+/**
+ * 读取当前节拍数和SysTick计数值（调用时已关中断）
+ *
+ * 关中断期间SysTick回绕后节拍中断挂起未处理，rt_tick_get()还没有加一，
+ * 此时按新节拍刚开始计算（与boot_time的处理相同）。
+ */
+static void lowpower_systick_now(rt_tick_t *tick, rt_uint32_t *val)
+{
+    *tick = rt_tick_get();
+    *val = SysTick->VAL;
+    if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+        (*tick)++;
+        *val = SysTick->LOAD;
+    }
+}
+
+/**
+ * 空闲钩子
+ */
+static void lowpower_idle_hook(void)
+{
+    rt_base_t level;
+    rt_tick_t next, sleep, t0, t1, t2;
+    rt_uint32_t v0, v1, us;
+    int veto;
+
+    level = rt_hw_interrupt_disable();
+
+    next = rt_timer_next_timeout_tick();
+    t0 = rt_tick_get();
+    if (next == RT_TICK_MAX) {
+        sleep = RT_TICK_MAX;
+    } else {
+        sleep = ((rt_int32_t)(next - t0) > 0) ? next - t0 : 0;
+    }
+
+    veto = lowpower_veto(sleep);
+    vetoes[veto]++;
+    if (veto == LP_VETO_NONE) {
+        /*
+         * 参数扇区写满时，趁所有线程都在等待足够远的定时器、且没有待上传记录时擦除，
+         * 擦除造成的停顿落在本来要睡眠的时间里。本次不再进入STOP，下次空闲时重新判断。
+         */
+        if (wifi_cache_erase_due() && upload_queue_count() == 0
+                && sleep >= rt_tick_from_millisecond(WIFI_CACHE_ERASE_MS)) {
+            lowpower_flash_erase();
+            rt_hw_interrupt_enable(level);
+            return;
+        }
+
+        /* 关中断期间变为就绪的线程会挂起PendSV，STOP会立即退出 */
+        lowpower_stop(sleep);
+        rt_hw_interrupt_enable(level);
+        return;
+    }
+
+    /*
+     * 退回WFI：SysTick照常运行，下一个中断即唤醒。
+     * 关中断执行WFI时，挂起的中断唤醒内核但不会进入处理函数，醒来后仍在关中断状态下
+     * 读取结束时刻，否则开中断后被唤醒的线程会先运行完，其运行时间被算作睡眠时间。
+     */
+    lowpower_systick_now(&t1, &v0);
+    __WFI();
+    lowpower_systick_now(&t2, &v1);
+
+    /* 按SysTick计数换算时长，与当前时钟档位无关；WFI期间DWT同样停止计数 */
+    us = lowpower_systick_us(t2 - t1, SysTick->LOAD, v0, v1);
+    wfi_us += us;
+    wfi_wakes++;
+    cpu_mon_idle_credit(us);
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * 控制台接收引脚下降沿：唤醒并在一段时间内不进入STOP
+ */
+static void lowpower_console_irq(void *args)
+{
+    console_activity = rt_tick_get();
+}
+
+/**
+ * RTC唤醒定时器中断
+ */
+void RTC_WKUP_IRQHandler(void)
+{
+    rt_interrupt_enter();
+    HAL_RTCEx_WakeUpTimerIRQHandler(&hrtc);
+    rt_interrupt_leave();
+}
+
+/**
+ * 初始化RTC唤醒定时器并安装空闲钩子
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t lowpower_init(void)
+{
+    /*
+     * RTC由板级RTC驱动（BSP_USING_ONCHIP_RTC，LSE）初始化并保存日历时间，time()依赖它，
+     * 这里不再调用HAL_RTC_Init，只借用同一个外设的唤醒定时器，并确认预分频与换算一致
+     */
+    if (rt_device_find("rtc") == RT_NULL) {
+        rt_kprintf("[LP] RTC device not found\n");
+        return -RT_ERROR;
+    }
+    if ((RTC->PRER & RTC_PRER_PREDIV_S) + 1 != LP_RTC_SUBSEC) {
+        rt_kprintf("[LP] Unexpected RTC prescaler\n");
+        return -RT_ERROR;
+    }
+    hrtc.Instance = RTC;
+    hrtc.State = HAL_RTC_STATE_READY;
+
+    HAL_NVIC_SetPriority(RTC_WKUP_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+
+    /*
+     * STOP模式下串口时钟停止，收不到字符。把RX引脚同时配置为EXTI下降沿中断，
+     * 第一个字符会丢失但能唤醒系统，之后一段时间保持不进入STOP。
+     * 使能中断时引脚会被配置为输入，需再切回复用功能。
+     */
+    console_activity = rt_tick_get();
+    if (rt_pin_attach_irq(LP_CONSOLE_RX_PIN, PIN_IRQ_MODE_FALLING, lowpower_console_irq, RT_NULL) == RT_EOK) {
+        rt_pin_irq_enable(LP_CONSOLE_RX_PIN, PIN_IRQ_ENABLE);
+        GPIOA->MODER = (GPIOA->MODER & ~GPIO_MODER_MODER10) | GPIO_MODER_MODER10_1;
+    } else {
+        rt_kprintf("[LP] Console wakeup pin unavailable\n");
+    }
+
+    stat_start = rt_tick_get();
+    return rt_thread_idle_sethook(lowpower_idle_hook);
+}
+
+/**
+ * 输出低功耗统计，并估算MCU功耗
+ */
+static void lowpower_dump(void)
+{
+    rt_uint32_t total_ms, stop_ms, wfi_ms, run_ms, avg_ua, i;
+    rt_base_t level;
+
+    level = rt_hw_interrupt_disable();
+    total_ms = (rt_tick_get() - stat_start) * 1000 / RT_TICK_PER_SECOND;
+    stop_ms = stop_ticks * 1000 / RT_TICK_PER_SECOND;
+    wfi_ms = wfi_us / 1000;
+    rt_hw_interrupt_enable(level);
+
+    if (total_ms == 0) {
+        return;
+    }
+    run_ms = (total_ms > stop_ms + wfi_ms) ? total_ms - stop_ms - wfi_ms : 0;
+    avg_ua = ((rt_uint64_t)run_ms * LP_RUN_UA + (rt_uint64_t)wfi_ms * LP_SLEEP_UA
+              + (rt_uint64_t)stop_ms * LP_STOP_UA) / total_ms;
+
+    rt_kprintf("lowpower: %s, window %d.%03d s\n", lp_enabled ? "on" : "off", total_ms / 1000, total_ms % 1000);
+    rt_kprintf("  run  %8d ms  (%d%%)\n", run_ms, run_ms * 100 / total_ms);
+    rt_kprintf("  wfi  %8d ms  (%d%%), %d wakeups\n", wfi_ms, wfi_ms * 100 / total_ms, wfi_wakes);
+    rt_kprintf("  stop %8d ms  (%d%%), %d wakeups\n", stop_ms, stop_ms * 100 / total_ms, stop_wakes);
+    if (flash_erases) {
+        rt_kprintf("  flash erases while idle: %d\n", flash_erases);
+    }
+    rt_kprintf("  wakeups: %d/s (tick-driven: %d/s)\n",
+               (rt_uint32_t)((rt_uint64_t)(wfi_wakes + stop_wakes) * 1000 / total_ms), RT_TICK_PER_SECOND);
+    rt_kprintf("  MCU avg %d.%02d mA, %d mJ (always-run: %d.%02d mA)\n",
+               avg_ua / 1000, avg_ua % 1000 / 10,
+               (rt_uint32_t)((rt_uint64_t)avg_ua * LP_VDD_MV / 1000 * total_ms / 1000000),
+               LP_RUN_UA / 1000, LP_RUN_UA % 1000 / 10);
+    rt_kprintf("  idle decisions:");
+    for (i = 0; i < LP_VETO_MAX; i++) {
+        if (i != LP_VETO_OFF || vetoes[i]) {
+            rt_kprintf(" %s=%d", veto_names[i], vetoes[i]);
+        }
+    }
+    rt_kprintf("\n");
+}
+
+/**
+ * 校验节拍补偿算法（RTC回绕、锚点换算、节拍计数回绕）
+ *
+ * 与主机测试tools/host/lowpower_tick_check.c的基本用例相同，用于确认目标编译器下的结果。
+ */
+static void lowpower_check(void)
+{
+    rt_uint32_t u, fail = 0;
+    rt_uint64_t abs;
+
+    /* 午夜回绕：23:59:59+200/256 到 00:00:00+10/256 经过66个单位 */
+    if (lowpower_day_delta(86399UL * LP_RTC_SUBSEC + 200, 10) != 66) {
+        rt_kprintf("FAIL day wrap\n");
+        fail++;
+    }
+    if (lowpower_day_delta(1000, 1000) != 0) {
+        rt_kprintf("FAIL zero delta\n");
+        fail++;
+    }
+
+    /* 任意时刻换算误差小于一个RTC单位，且不随时间累积 */
+    for (u = 0; u < 4 * LP_RTC_SUBSEC; u++) {
+        rt_int32_t err = (rt_int32_t)(lowpower_expected_tick(0, 0, u) * LP_RTC_SUBSEC)
+                         - (rt_int32_t)(u * RT_TICK_PER_SECOND);
+        if (err > 0 || -err >= RT_TICK_PER_SECOND) {
+            rt_kprintf("FAIL rounding at %d units\n", u);
+            fail++;
+            break;
+        }
+    }
+    for (abs = 0; abs <= 40ULL * LP_RTC_DAY_UNITS; abs += LP_RTC_DAY_UNITS) {
+        if (lowpower_expected_tick(5, 7, 7 + abs) != 5 + abs / LP_RTC_SUBSEC * RT_TICK_PER_SECOND) {
+            rt_kprintf("FAIL drift after %d days\n", (rt_uint32_t)(abs / LP_RTC_DAY_UNITS));
+            fail++;
+            break;
+        }
+    }
+
+    /* 节拍计数回绕 */
+    if (lowpower_expected_tick(0xFFFFFF00UL, 0, LP_RTC_SUBSEC) != (rt_tick_t)(0xFFFFFF00UL + RT_TICK_PER_SECOND)) {
+        rt_kprintf("FAIL tick wrap\n");
+        fail++;
+    }
+
+    rt_kprintf("lowpower check: %s\n", fail ? "FAILED" : "passed");
+}
+
+/**
+ * msh命令：低功耗空闲统计与开关
+ *
+ * 用法：lowpower [on|off|reset|check]
+ */
+static int lowpower(int argc, char **argv)
+{
+    if (argc > 1 && rt_strcmp(argv[1], "on") == 0) {
+        lp_enabled = RT_TRUE;
+    } else if (argc > 1 && rt_strcmp(argv[1], "off") == 0) {
+        lp_enabled = RT_FALSE;
+    } else if (argc > 1 && rt_strcmp(argv[1], "check") == 0) {
+        lowpower_check();
+        return 0;
+    }
+
+    lowpower_dump();
+
+    if (argc > 1 && rt_strcmp(argv[1], "reset") == 0) {
+        rt_base_t level = rt_hw_interrupt_disable();
+        stat_start = rt_tick_get();
+        stop_ticks = 0;
+        wfi_us = 0;
+        stop_wakes = 0;
+        wfi_wakes = 0;
+        flash_erases = 0;
+        rt_memset(vetoes, 0, sizeof(vetoes));
+        rt_hw_interrupt_enable(level);
+    }
+    return 0;
+}
+MSH_CMD_EXPORT(lowpower, tickless idle stats: lowpower [on|off|reset|check]);
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         无节拍低功耗空闲（STOP模式+RTC唤醒）
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __LOWPOWER_H__
+#define __LOWPOWER_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 初始化RTC唤醒定时器并安装空闲钩子
+ *
+ * 空闲时按最近的定时器到期时刻计算可睡眠时长，足够长且外设空闲时停掉SysTick
+ * 进入STOP模式，由RTC唤醒定时器（LSE）唤醒，醒来后按RTC计时补偿系统节拍；
+ * 否则只执行WFI，等待下一个节拍中断。
+ * RTC本身由板级RTC驱动（BSP_USING_ONCHIP_RTC）初始化，须在其之后调用。
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t lowpower_init(void);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
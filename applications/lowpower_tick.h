@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         低功耗空闲的节拍补偿换算
+ */
+
+/*
+ * 节拍补偿和睡眠时长的换算，只依赖rtthread.h中的类型和RT_TICK_PER_SECOND，
+ * 供lowpower.c使用，也可以在主机上单独编译测试（tools/host/lowpower_tick_check.c）。
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __LOWPOWER_TICK_H__
+#define __LOWPOWER_TICK_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LP_RTC_SUBSEC       256         // RTC同步预分频（PREDIV_S+1），亚秒分辨率1/256秒
+#define LP_RTC_DAY_UNITS    (86400UL * LP_RTC_SUBSEC)
+
+/**
+ * 计算一天内两个RTC时间（1/256秒）的差，处理午夜回绕
+ */
+rt_inline rt_uint32_t lowpower_day_delta(rt_uint32_t before, rt_uint32_t after)
+{
+    return (after >= before) ? after - before : after + LP_RTC_DAY_UNITS - before;
+}
+
+/**
+ * 由锚点(节拍, RTC时间)和当前RTC时间计算应有的节拍数
+ *
+ * 每次都从锚点换算而不是累加每次睡眠的时长，RTC量化误差不会累积。
+ */
+rt_inline rt_tick_t lowpower_expected_tick(rt_tick_t anchor_tick, rt_uint64_t anchor_rtc, rt_uint64_t now_rtc)
+{
+    return anchor_tick + (rt_tick_t)((now_rtc - anchor_rtc) * RT_TICK_PER_SECOND / LP_RTC_SUBSEC);
+}
+
+/**
+ * 由前后两次读到的节拍数和SysTick计数值换算经过的时间（微秒）
+ *
+ * SysTick向下计数，每个节拍重装为load，换算只与节拍周期有关，与当前时钟档位无关。
+ *
+ * @param ticks 两次读取之间经过的节拍数
+ * @param load  SysTick->LOAD
+ * @param v0    开始时的SysTick->VAL
+ * @param v1    结束时的SysTick->VAL
+ */
+rt_inline rt_uint32_t lowpower_systick_us(rt_tick_t ticks, rt_uint32_t load, rt_uint32_t v0, rt_uint32_t v1)
+{
+    return (rt_uint32_t)(((rt_uint64_t)ticks * (load + 1) + v0 - v1)
+                         * (1000000 / RT_TICK_PER_SECOND) / (load + 1));
+}
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
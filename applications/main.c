@@ -12,11 +12,31 @@
 #include <rtdevice.h>
 #include <board.h>
 #include <string.h>
+#include <stdlib.h>
 
 #include <drv_lcd.h>
 #include <rttlogo.h>
 #include "aht20.h"  // AHT20驱动
 #include "ap3216c.h"  // AP3216C驱动
+#include "net_state.h"  // 网络连接状态机
+#include "net_probe.h"  // 服务器可达性探测
+#include "wifi_cache.h"  // WiFi快速重连缓存
+#include "uplink_tls.h"  // HTTPS上传
+#include "upload_queue.h"  // 带序号的上传队列
+#include "lcd_text.h"  // LCD文本增量刷新
+#include "lcd_fb.h"  // 外部SRAM帧缓冲
+#include "lcd_chart.h"  // 趋势图
+#include "lcd_glyph.h"  // 数字字形缓存
+#include "disp_power.h"  // 背光与显示电源管理
+#include "perf.h"  // 性能剖析
+#include "cpu_mon.h"  // 线程CPU占用监视
+#include "mem_region.h"  // 多区域内存分配
+#include "web_pool.h"  // webclient内存池
+#include "dlog.h"  // 异步日志
+#include "trace.h"  // RTT事件跟踪
+#include "lowpower.h"  // 无节拍低功耗空闲
+#include "clock_scale.h"  // 动态调频
+#include "boot_time.h"  // 启动时间线
 
 /* 网络相关头文件 */
 #include <wlan_mgnt.h>
@@ -46,110 +66,239 @@ static float g_humidity = 0.0f;      // 湿度数据
 static float g_brightness = 0.0f;     // 光照强度数据
 static rt_mutex_t g_sensor_mutex = RT_NULL;  // 保护传感器数据的互斥锁
 
-/* 网络相关变量 */
-static struct rt_semaphore net_ready;  // 网络就绪信号量
-static int network_connected = 0;      // 网络连接状态标志
-static rt_mutex_t net_state_mutex = RT_NULL;  // 保护网络状态的互斥锁
+/* LCD文本字段：只重绘内容变化的字符 */
+static struct lcd_text temp_text;    // 温度
+static struct lcd_text humi_text;    // 湿度
+static struct lcd_text light_text;   // 光照
+static struct lcd_text net_text;     // 网络状态
+
+#ifdef LCD_USING_FRAMEBUFFER
+/* 数值右侧的10分钟趋势图（纵轴范围与网页仪表盘一致） */
+#define CHART_X           184           // 趋势图X坐标（数值文本宽168像素，结束于178）
+#define CHART_W           (LCD_W - CHART_X - LCD_CHART_LABEL_W)  // 趋势图宽度（36，右侧为刻度）
+#define CHART_H           22            // 趋势图高度
+#define CHART_SPAN_MS     (10 * 60 * 1000)  // 趋势图覆盖时间
+
+static struct lcd_chart temp_chart;  // 温度趋势
+static struct lcd_chart humi_chart;  // 湿度趋势
+static struct lcd_chart light_chart; // 光照趋势
+#endif
+
+/* 显示线程参数 */
+#define DISPLAY_FRAME_MS      200         // 最短帧间隔，期间的刷新请求合并为一帧
+#define DISPLAY_STACK_SIZE    2048        // 显示线程栈大小
+#define DISPLAY_EVT_DIRTY     (1 << 0)    // 显示内容需要刷新
+#define PS_NEAR_THRESHOLD     200         // 接近传感器读数超过该值视为有人靠近
+
+static struct rt_event display_evt;          // 刷新请求事件
+static rt_bool_t display_sync = RT_FALSE;    // 为真时在请求方线程中同步绘制（旧方式，用于对比）
+static rt_bool_t g_aht20_error = RT_FALSE;   // AHT20读取失败标志
+
+/* 显示统计 */
+static rt_uint32_t display_requests = 0;     // 刷新请求次数
+static rt_uint32_t display_frames = 0;       // 实际绘制帧数
+static rt_uint32_t aht20_block_max = 0;      // AHT20线程更新数据时的最长阻塞时间（us）
+static rt_uint32_t ap3216c_block_max = 0;    // AP3216C线程更新数据时的最长阻塞时间（us）
 
 /* HTTP上传配置 */
-#define UPLOAD_INTERVAL   1000    // 上传间隔1秒
+#define UPLOAD_INTERVAL   1000    // 采样上传间隔1秒
 #define SERVER_IP         "192.168.90.106"  // 本地服务器IP
 #define SERVER_PORT       8000             // 服务器端口
 #define UPLOAD_PATH       "/upload"        // 上传接口路径
+// #define UPLOAD_USING_TLS                 // 定义后通过HTTPS上传（复用TLS会话）
+
+/* WiFi配置 */
+#define WIFI_SSID             "iQOO Neo9"   // 热点名称
+#define WIFI_PASSWORD         "1234567890"  // 热点密码
+#define WIFI_IP_TIMEOUT       15000         // 关联后等待获取IP的超时时间(ms)
+#define WIFI_RETRY_INTERVAL   2000          // 连接失败后的重试间隔(ms)
+#define WIFI_VERIFY_TIMEOUT   5000          // 获取IP后等待服务器可达的超时时间(ms)
+#define WIFI_INIT_TIMEOUT     500           // 等待WiFi模块就绪的最长时间(ms)
+
+/* 启动顺序：默认开机画面在显示线程中绘制，与传感器初始化、WiFi连接并行；
+ * 定义后恢复旧的串行顺序（main中先画完开机画面），用于对比启动时间线 */
+// #define BOOT_USING_SERIAL_START
+
+/**
+ * 计算从现在到指定时刻还需等待的tick数
+ *
+ * @param deadline 目标时刻
+ * @return 剩余tick数，已到达返回0
+ */
+static rt_int32_t ticks_until(rt_tick_t deadline)
+{
+    rt_int32_t remain = (rt_int32_t)(deadline - rt_tick_get());
+    return remain > 0 ? remain : 0;
+}
 
 /**
  * HTTP上传线程入口函数
  *
+ * 采样与发送解耦：每个上传周期生成一条带序号的记录放入队列，
+ * 发送失败时原样重发队首记录，服务器按序号去重。
+ *
  * @param parameter 线程参数
  */
 static void http_upload_thread_entry(void *parameter)
 {
     char url[256];                          // URL缓冲区
+    char path[160];                         // 请求路径（含查询参数）
+#ifndef UPLOAD_USING_TLS
     struct webclient_session *session = RT_NULL;  // 网络会话句柄
+#endif
     int response_status = 0;                // 响应状态码
     char response_buffer[1024] = {0};       // 响应数据缓冲区
     int upload_attempts = 0;                // 上传尝试次数
+    rt_tick_t next_sample = rt_tick_get();  // 下一次采样时刻
+    rt_tick_t next_retry = rt_tick_get();   // 退避结束时刻
+    rt_int32_t wait_ticks;                  // 本轮等待时间
+    struct upload_record *rec;              // 当前发送的记录
+    clock_level_t clk_level;                // 本次上传申请的时钟档位
 
     rt_kprintf("[HTTP] Upload thread started\n");
 
     while (1) {
-        /* 等待网络连接就绪 */
-        rt_mutex_take(net_state_mutex, RT_WAITING_FOREVER);
-        int connected = network_connected;
-        rt_mutex_release(net_state_mutex);
-
-        if (connected) {
-            /* 保护读取传感器数据 */
+        /* 到达采样时刻则生成新记录，断网期间的记录在队列中积压 */
+        if (ticks_until(next_sample) == 0) {
             rt_mutex_take(g_sensor_mutex, RT_WAITING_FOREVER);
             int temp = (int)g_temperature;
             int humi = (int)g_humidity;
             int light = (int)g_brightness;
             rt_mutex_release(g_sensor_mutex);
 
-            /* 构造完整的GET请求URL */
-            rt_snprintf(url, sizeof(url),
-                       "http://%s:%d%s?temp=%d&humi=%d&light=%d",
-                       SERVER_IP, SERVER_PORT, UPLOAD_PATH, temp, humi, light);
-
-            rt_kprintf("[HTTP] Uploading to: %s\n", url);
+            upload_queue_push(temp, humi, light);
+            next_sample = rt_tick_get() + rt_tick_from_millisecond(UPLOAD_INTERVAL);
+        }
 
-            /* 创建会话 */
-            session = webclient_session_create(1024);
-            if (session == RT_NULL) {
-                rt_kprintf("[HTTP] Failed to create session, retry in 1s\n");
-                rt_thread_mdelay(1000);
-                continue;
+        /* 服务器不可达期间阻塞等待（每个采样周期醒来一次），探测到可达后立即开始上传 */
+        if (net_state_get() < NET_STATE_REACHABLE) {
+            if (net_state_wait(NET_STATE_REACHABLE, ticks_until(next_sample)) == RT_EOK) {
+                DLOG_I("[HTTP] Server reachable, %d records pending\n", upload_queue_count());
+                upload_attempts = 0;  // 恢复后不沿用之前的退避
+                next_retry = rt_tick_get();
             }
+            continue;
+        }
 
-            /* 设置超时时间 */
-            webclient_set_timeout(session, 5000);  // 5秒超时
-
-            /* 发送GET请求 */
-            response_status = webclient_get(session, url);
-
-            /* 处理响应 */
-            if (response_status == 200) {
-                /* 读取响应内容 */
-                int read_len = webclient_read(session, response_buffer, sizeof(response_buffer) - 1);
-                if (read_len > 0) {
-                    response_buffer[read_len] = '\0';
-                    rt_kprintf("[HTTP] Response: %s\n", response_buffer);
-                    if (strstr(response_buffer, "OK") != NULL) {
-                        rt_kprintf("[HTTP] Upload success!\n");
-                        upload_attempts = 0;  // 重置尝试次数
-                    }
-                } else {
-                    rt_kprintf("[HTTP] Upload success, empty response\n");
-                    upload_attempts = 0;  // 空响应视为成功
-                }
-            } else {
-                rt_kprintf("[HTTP] Upload failed, status: %d\n", response_status);
-                upload_attempts++;
+        /* 退避期间只按周期采样；若网络断开则提前返回，重新等待连接 */
+        wait_ticks = ticks_until(next_retry);
+        if (wait_ticks > 0) {
+            net_state_wait(NET_STATE_DOWN, wait_ticks < ticks_until(next_sample) ?
+                           wait_ticks : ticks_until(next_sample));
+            continue;
+        }
+
+        /* 队列已清空，等待下一次采样 */
+        rec = upload_queue_peek();
+        if (rec == RT_NULL) {
+            wait_ticks = ticks_until(next_sample);
+            if (wait_ticks > 0) {
+                rt_thread_delay(wait_ticks);
             }
+            continue;
+        }
 
-            /* 关闭会话 */
-            webclient_close(session);
-            session = RT_NULL;
-
-            /* 指数退避重试策略 */
-            if (upload_attempts > 0) {
-                int backoff_time = 1000 * (1 << (upload_attempts > 5 ? 5 : upload_attempts));
-                rt_kprintf("[HTTP] Retry attempt %d, waiting %d ms...\n",
-                          upload_attempts, backoff_time);
-                rt_thread_mdelay(backoff_time);
-            } else {
-                // 上传成功后等待固定间隔（1秒）
-                rt_thread_mdelay(UPLOAD_INTERVAL);
+        /* 补传积压记录时满速，单条上传只需中档 */
+        clk_level = (upload_queue_count() > 1) ? CLOCK_LEVEL_HIGH : CLOCK_LEVEL_MID;
+        clock_scale_request(clk_level);
+
+        /*
+         * 构造完整的GET请求URL，age为记录已等待的时间，便于服务器还原采样时刻；
+         * cpu为上传时上一个统计周期的CPU负载（千分比）
+         */
+        PERF_BEGIN(PERF_URL_FORMAT);
+        rt_snprintf(path, sizeof(path),
+                    "%s?dev=%08x&boot=%08x&seq=%u&age=%u&temp=%d&humi=%d&light=%d&cpu=%u",
+                    UPLOAD_PATH, upload_queue_device_id(), upload_queue_boot_id(), rec->seq,
+                    (rt_uint32_t)((rt_tick_get() - rec->tick) * 1000 / RT_TICK_PER_SECOND),
+                    rec->temp, rec->humi, rec->light, cpu_mon_load());
+#ifdef UPLOAD_USING_TLS
+        rt_snprintf(url, sizeof(url), "https://%s:%d%s", SERVER_IP, SERVER_PORT, path);
+#else
+        rt_snprintf(url, sizeof(url), "http://%s:%d%s", SERVER_IP, SERVER_PORT, path);
+#endif
+        PERF_END(PERF_URL_FORMAT);
+
+        DLOG_I("[HTTP] Uploading to: %s\n", url);
+
+#ifdef UPLOAD_USING_TLS
+        /* HTTPS：每次重新连接，但复用TLS会话 */
+        response_status = uplink_tls_get(SERVER_IP, SERVER_PORT, path,
+                                         response_buffer, sizeof(response_buffer));
+#else
+        /* 创建会话 */
+        session = webclient_session_create(1024);
+        if (session == RT_NULL) {
+            DLOG_E("[HTTP] Failed to create session, retry in 1s\n");
+            next_retry = rt_tick_get() + rt_tick_from_millisecond(1000);
+            clock_scale_release(clk_level);
+            continue;
+        }
+
+        /* 设置超时时间 */
+        webclient_set_timeout(session, 5000);  // 5秒超时
+
+        /* 发送GET请求（连接、发送请求、接收响应头） */
+        PERF_BEGIN(PERF_HTTP_REQUEST);
+        response_status = webclient_get(session, url);
+        PERF_END(PERF_HTTP_REQUEST);
+#endif
+
+        /* 处理响应 */
+        if (response_status == 200) {
+            /* 读取响应内容 */
+#ifdef UPLOAD_USING_TLS
+            int read_len = rt_strlen(response_buffer);
+#else
+            PERF_BEGIN(PERF_HTTP_READ);
+            int read_len = webclient_read(session, response_buffer, sizeof(response_buffer) - 1);
+            PERF_END(PERF_HTTP_READ);
+#endif
+            if (read_len > 0) {
+                response_buffer[read_len] = '\0';
+                DLOG_D("[HTTP] Response: %s\n", response_buffer);
             }
+            /* 200即表示服务器已保存该序号（含重复提交），记录出队 */
+            DLOG_I("[HTTP] Upload success! seq %u\n", rec->seq);
+            upload_queue_pop();
+            upload_attempts = 0;  // 重置尝试次数
+            net_state_mark_upload();
+            boot_mark(BOOT_FIRST_UPLOAD);
+        } else if (response_status >= 400 && response_status < 500) {
+            /* 请求本身有误，重发也不会成功，丢弃该记录以免阻塞队列 */
+            DLOG_W("[HTTP] Record seq %u rejected, status: %d\n", rec->seq, response_status);
+            upload_queue_reject();
         } else {
-            rt_kprintf("[HTTP] Network not ready, waiting...\n");
-            rt_thread_mdelay(5000);
+            DLOG_W("[HTTP] Upload failed, status: %d\n", response_status);
+            upload_attempts++;
+
+            /* 连接失败说明服务器不可达，交由探测线程确认恢复 */
+            if (response_status < 0) {
+                net_state_change(NET_STATE_REACHABLE, NET_STATE_IP_ACQUIRED);
+            }
+        }
+
+#ifndef UPLOAD_USING_TLS
+        /* 关闭会话 */
+        webclient_close(session);
+        session = RT_NULL;
+#endif
+        clock_scale_release(clk_level);
+
+        /* 指数退避重试策略，重试时发送同一条记录 */
+        if (upload_attempts > 0) {
+            int backoff_time = 1000 * (1 << (upload_attempts > 5 ? 5 : upload_attempts));
+            DLOG_W("[HTTP] Retry attempt %d, waiting %d ms...\n",
+                   upload_attempts, backoff_time);
+            next_retry = rt_tick_get() + rt_tick_from_millisecond(backoff_time);
         }
     }
 }
 
 /**
  * 在LCD上显示传感器数据和网络状态
+ *
+ * 只在持锁期间复制数据快照，绘制在锁外进行。
  */
 static void display_sensor_data(void)
 {
@@ -157,7 +306,15 @@ static void display_sensor_data(void)
     char humi_str[30];      // 湿度显示字符串
     char light_str[30];     // 光照显示字符串
     char net_str[30];       // 网络状态显示字符串
-    int connected_state;    // 网络连接状态
+    rt_bool_t connected_state;  // 网络连接状态
+    rt_bool_t sensor_error;     // AHT20是否读取失败
+
+    /* 屏幕休眠期间暂停绘制，唤醒后由电源管理重新请求刷新 */
+    if (!disp_power_is_on()) {
+        return;
+    }
+
+    PERF_BEGIN(PERF_LCD_DRAW);
 
     /* 加锁保护共享数据 */
     rt_mutex_take(g_sensor_mutex, RT_WAITING_FOREVER);
@@ -165,33 +322,185 @@ static void display_sensor_data(void)
     /* 格式化温湿度数据 */
     rt_snprintf(temp_str, sizeof(temp_str), "Temp(C): %5d", (int)g_temperature);
     rt_snprintf(humi_str, sizeof(humi_str), "Humi(%%): %5d", (int)g_humidity);
-    rt_snprintf(light_str, sizeof(light_str), "Light(lux): %5d", (int)g_brightness);
+    rt_snprintf(light_str, sizeof(light_str), "Light:   %5d", (int)g_brightness);
+    sensor_error = g_aht20_error;
 
     /* 释放锁 */
     rt_mutex_release(g_sensor_mutex);
 
     /* 获取网络连接状态 */
-    rt_mutex_take(net_state_mutex, RT_WAITING_FOREVER);
-    connected_state = network_connected;
-    rt_mutex_release(net_state_mutex);
-
-    /* 设置显示颜色 */
-    lcd_set_color(WHITE, BLACK);
+    connected_state = (net_state_get() >= NET_STATE_IP_ACQUIRED);
 
-    /* 显示温湿度数据 */
-    lcd_show_string(10, 120, 24, temp_str);
-    lcd_show_string(10, 150, 24, humi_str);
-    lcd_show_string(10, 180, 24, light_str);
+    /* 显示温湿度数据（未变化的字符不会重绘） */
+    if (sensor_error) {
+        lcd_text_update(&temp_text, "Sensor Error!", WHITE, RED);
+    } else {
+        lcd_text_update(&temp_text, temp_str, WHITE, BLACK);
+    }
+    lcd_text_update(&humi_text, humi_str, WHITE, BLACK);
+    lcd_text_update(&light_text, light_str, WHITE, BLACK);
 
     /* 显示网络状态 */
     if (connected_state) {
         rt_snprintf(net_str, sizeof(net_str), "NET:    CONNECTED");
-        lcd_set_color(GREEN, BLACK);
+        lcd_text_update(&net_text, net_str, GREEN, BLACK);
     } else {
         rt_snprintf(net_str, sizeof(net_str), "NET: DISCONNECTED");
-        lcd_set_color(RED, BLACK);
+        lcd_text_update(&net_text, net_str, RED, BLACK);
+    }
+
+#ifdef LCD_USING_FRAMEBUFFER
+    /* 绘制趋势图中新结束的列（采样在传感器线程中进行） */
+    if (lcd_fb_ready()) {
+        lcd_chart_draw(&temp_chart);
+        lcd_chart_draw(&humi_chart);
+        lcd_chart_draw(&light_chart);
+    }
+#endif
+    PERF_END(PERF_LCD_DRAW);
+
+#ifdef LCD_USING_FRAMEBUFFER
+    /* 一帧绘制完成后，把脏矩形一次性刷新到屏幕 */
+    if (lcd_fb_ready()) {
+        PERF_BEGIN(PERF_LCD_FLUSH);
+        lcd_fb_flush();
+        PERF_END(PERF_LCD_FLUSH);
+    }
+#endif
+    display_frames++;
+    boot_mark(BOOT_FIRST_FRAME);
+}
+
+/**
+ * 请求刷新显示，只投递事件，不在调用方线程中绘制
+ */
+static void display_request(void)
+{
+    display_requests++;
+
+    if (display_sync) {
+        /* 旧方式：在调用方线程中持锁绘制 */
+        rt_mutex_take(g_sensor_mutex, RT_WAITING_FOREVER);
+        display_sensor_data();
+        rt_mutex_release(g_sensor_mutex);
+    } else {
+        rt_event_send(&display_evt, DISPLAY_EVT_DIRTY);
+    }
+}
+
+/**
+ * 记录一次数据更新的阻塞时间（按当前主频换算为微秒，clock_scale切换档位后仍可比较）
+ *
+ * @param begin 开始等待锁时的周期计数（DWT已由lcd_text_init启用）
+ * @param max   最长阻塞时间（us）
+ */
+static void display_account_block(rt_uint32_t begin, rt_uint32_t *max)
+{
+    rt_uint32_t us = (DWT->CYCCNT - begin) / (SystemCoreClock / 1000000);  // 本次阻塞时间
+
+    if (us > *max) {
+        *max = us;
+    }
+}
+
+/**
+ * 直接在屏幕上绘制开机画面（未启用帧缓冲或帧缓冲不可用时）
+ */
+static void display_splash_direct(void)
+{
+    /* 初始化LCD */
+    lcd_clear(WHITE);
+
+    /* 设置背景色和前景色 */
+    lcd_set_color(WHITE, BLACK);
+
+    /* 显示RT-Thread logo（RLE压缩，逐段解码直接写入LCD窗口） */
+    lcd_rle_show(0, 0, &image_rttlogo);
+
+    /* 在LCD上显示标题 */
+    lcd_show_string(10, 69, 16, "Hello, World!");
+    lcd_show_string(10, 69 + 16, 24, "Sensors Monitoring:");
+
+    /* 绘制分隔线 */
+    lcd_draw_line(0, 69 + 16 + 24, 240, 69 + 16 + 24);
+}
+
+/**
+ * 绘制开机画面并初始化各显示字段
+ *
+ * 默认在显示线程中执行，与传感器初始化、WiFi连接并行。
+ * 帧缓冲初始化失败时改为直接写屏，不显示趋势图。
+ */
+static void display_splash(void)
+{
+    clock_scale_request(CLOCK_LEVEL_HIGH);
+
+#ifdef LCD_USING_FRAMEBUFFER
+    /* 在帧缓冲中绘制整屏初始画面，再一次性刷新到屏幕 */
+    if (lcd_fb_init(WHITE) == RT_EOK) {
+        lcd_fb_rle_image(0, 0, &image_rttlogo);
+        lcd_fb_string(10, 69, 16, "Hello, World!", WHITE, BLACK);
+        lcd_fb_string(10, 69 + 16, 24, "Sensors Monitoring:", WHITE, BLACK);
+        lcd_fb_hline(0, 69 + 16 + 24, 240, BLACK);
+        lcd_fb_flush();
+    } else {
+        rt_kprintf("Failed to init framebuffer, drawing directly to the panel\n");
+        display_splash_direct();
+    }
+#else
+    display_splash_direct();
+#endif
+
+    /* 预渲染数值字段使用的数字字形 */
+    lcd_glyph_cache_init(WHITE, BLACK);
+
+    /* 初始化传感器数据显示字段 */
+    lcd_text_init(&temp_text, 10, 120, 24);
+    lcd_text_init(&humi_text, 10, 150, 24);
+    lcd_text_init(&light_text, 10, 180, 24);
+    lcd_text_init(&net_text, 10, 210, 24);
+
+#ifdef LCD_USING_FRAMEBUFFER
+    /* 初始化趋势图（未初始化的趋势图忽略采样） */
+    if (lcd_fb_ready()) {
+        lcd_chart_init(&temp_chart, CHART_X, 121, CHART_W, CHART_H, 10, 40, CHART_SPAN_MS, WHITE, RED);
+        lcd_chart_init(&humi_chart, CHART_X, 151, CHART_W, CHART_H, 0, 100, CHART_SPAN_MS, WHITE, BLUE);
+        lcd_chart_init(&light_chart, CHART_X, 181, CHART_W, CHART_H, 0, 15000, CHART_SPAN_MS, WHITE, BLACK);
+    }
+#endif
+
+    clock_scale_release(CLOCK_LEVEL_HIGH);
+    boot_mark(BOOT_SPLASH);
+}
+
+/**
+ * LCD刷新线程入口函数
+ *
+ * 收到刷新请求后绘制一帧，然后至少间隔DISPLAY_FRAME_MS，
+ * 间隔内到达的请求合并到下一帧。
+ *
+ * @param parameter 线程参数
+ */
+static void display_thread_entry(void *parameter)
+{
+    rt_uint32_t recved;  // 收到的事件
+
+#ifndef BOOT_USING_SERIAL_START
+    display_splash();
+#endif
+
+    while (1) {
+        rt_event_recv(&display_evt, DISPLAY_EVT_DIRTY,
+                      RT_EVENT_FLAG_OR | RT_EVENT_FLAG_CLEAR,
+                      RT_WAITING_FOREVER, &recved);
+
+        /* 绘制和刷新是短时突发，满速完成后尽快降频 */
+        clock_scale_request(CLOCK_LEVEL_HIGH);
+        display_sensor_data();
+        clock_scale_release(CLOCK_LEVEL_HIGH);
+
+        rt_thread_mdelay(DISPLAY_FRAME_MS);
     }
-    lcd_show_string(10, 210, 24, net_str);
 }
 
 /**
@@ -202,6 +511,8 @@ static void display_sensor_data(void)
 static void aht20_read_thread_entry(void *parameter)
 {
     rt_err_t result;  // 函数返回值
+    float temperature, humidity;  // 本次读取的温湿度
+    rt_uint32_t begin;            // 开始更新共享数据时的周期计数
 
     rt_kprintf("[AHT20] Initializing...\n");
     aht20_dev = aht20_init("i2c3");
@@ -212,28 +523,39 @@ static void aht20_read_thread_entry(void *parameter)
     rt_kprintf("[AHT20] Initialization successful\n");
 
     while (1) {
-        rt_kprintf("[AHT20] Reading data...\n");
+        DLOG_D("[AHT20] Reading data...\n");
 
         // 读取传感器数据
-        result = aht20_read_temperature_humidity(aht20_dev, &g_temperature, &g_humidity);
+        result = aht20_read_temperature_humidity(aht20_dev, &temperature, &humidity);
 
         if (result == RT_EOK) {
-            /* 读取成功，更新显示 */
-            rt_mutex_take(g_sensor_mutex, RT_WAITING_FOREVER);
-            rt_kprintf("[AHT20] Temperature: %d C, Humidity: %d %%\n",
-                       (int)g_temperature, (int)g_humidity);
-            display_sensor_data();
-            rt_mutex_release(g_sensor_mutex);
+            DLOG_I("[AHT20] Temperature: %d C, Humidity: %d %%\n",
+                   (int)temperature, (int)humidity);
+            boot_mark(BOOT_FIRST_SAMPLE);
         } else {
-            rt_kprintf("[AHT20] Read failed (error code: %d), resetting...\n", result);
+            DLOG_E("[AHT20] Read failed (error code: %d), resetting...\n", result);
             aht20_reset(aht20_dev);
+        }
 
-            /* 显示错误信息 */
-            rt_mutex_take(g_sensor_mutex, RT_WAITING_FOREVER);
-            lcd_set_color(WHITE, RED);
-            lcd_show_string(10, 120, 24, "Sensor Error!");
-            rt_mutex_release(g_sensor_mutex);
+        /* 更新共享数据并请求刷新显示（错误信息由显示线程绘制） */
+        begin = DWT->CYCCNT;
+        rt_mutex_take(g_sensor_mutex, RT_WAITING_FOREVER);
+        if (result == RT_EOK) {
+            g_temperature = temperature;
+            g_humidity = humidity;
+        }
+        g_aht20_error = (result != RT_EOK);
+        display_request();
+        rt_mutex_release(g_sensor_mutex);
+        display_account_block(begin, &aht20_block_max);
+
+#ifdef LCD_USING_FRAMEBUFFER
+        /* 趋势图按采样更新，屏幕休眠期间也不中断 */
+        if (result == RT_EOK) {
+            lcd_chart_sample(&temp_chart, temperature);
+            lcd_chart_sample(&humi_chart, humidity);
         }
+#endif
 
         // 统一为1秒读取一次
         rt_thread_mdelay(1000);
@@ -256,17 +578,33 @@ static void ap3216c_read_thread_entry(void *parameter)
     rt_kprintf("[AP3216C] Initialization successful\n");
 
     while (1) {
+        rt_uint32_t begin;  // 开始更新共享数据时的周期计数
+
+        PERF_BEGIN(PERF_AP3216C_READ);
         float brightness = ap3216c_read_ambient_light(ap3216c_dev);
+        PERF_END(PERF_AP3216C_READ);
+
+        /* 有人靠近时保持屏幕点亮 */
+        if (ap3216c_read_ps_data(ap3216c_dev) > PS_NEAR_THRESHOLD) {
+            disp_power_activity();
+        }
 
         if (brightness >= 0) {  // 正数表示有效数据
+            DLOG_I("[AP3216C] Ambient light: %d lux\n", (int)brightness);
+            disp_power_lux(brightness);  // 按环境光调节背光
+
             // 加锁保护共享变量
+            begin = DWT->CYCCNT;
             rt_mutex_take(g_sensor_mutex, RT_WAITING_FOREVER);
             g_brightness = brightness;
-            rt_kprintf("[AP3216C] Ambient light: %d lux\n", (int)g_brightness);
-            display_sensor_data();  // 更新显示
+            display_request();  // 请求刷新显示
             rt_mutex_release(g_sensor_mutex);
+            display_account_block(begin, &ap3216c_block_max);
+#ifdef LCD_USING_FRAMEBUFFER
+            lcd_chart_sample(&light_chart, brightness);
+#endif
         } else {
-            rt_kprintf("[AP3216C] Read failed\n");
+            DLOG_E("[AP3216C] Read failed\n");
         }
 
         // 保持1秒读取间隔
@@ -277,25 +615,19 @@ static void ap3216c_read_thread_entry(void *parameter)
 /**
  * 网络就绪事件回调函数
  *
+ * 回调运行在wlan工作队列线程中，只投递状态事件，
+ * 连通性探测由net_probe线程完成，显示由显示线程刷新。
+ *
  * @param event 事件类型
  * @param buff 事件缓冲区
  * @param parameter 用户参数
  */
 void wlan_ready_handler(int event, struct rt_wlan_buff *buff, void *parameter)
 {
-    rt_sem_release(&net_ready);
-
-    /* 保护网络状态变量 */
-    rt_mutex_take(net_state_mutex, RT_WAITING_FOREVER);
-    network_connected = 1;
-    rt_mutex_release(net_state_mutex);
-
-    display_sensor_data();  // 更新网络状态显示
-
-    // 测试网络连通性（修改：使用SERVER_IP而非SERVER_DOMAIN）
-    char ping_cmd[128];
-    rt_snprintf(ping_cmd, sizeof(ping_cmd), "ping %s", SERVER_IP);
-    msh_exec(ping_cmd, rt_strlen(ping_cmd));
+    /* DHCP续约同样会触发该事件，此时不能把REACHABLE降级 */
+    net_state_change(NET_STATE_DOWN, NET_STATE_IP_ACQUIRED);
+    net_state_change(NET_STATE_ASSOCIATING, NET_STATE_IP_ACQUIRED);
+    display_request();
 }
 
 /**
@@ -309,12 +641,8 @@ void wlan_station_disconnect_handler(int event, struct rt_wlan_buff *buff, void
 {
     rt_kprintf("Network disconnected!\n");
 
-    /* 保护网络状态变量 */
-    rt_mutex_take(net_state_mutex, RT_WAITING_FOREVER);
-    network_connected = 0;
-    rt_mutex_release(net_state_mutex);
-
-    display_sensor_data();  // 更新网络状态显示
+    net_state_set(NET_STATE_DOWN);
+    display_request();
 }
 
 /**
@@ -347,6 +675,9 @@ static void wlan_connect_fail_handler(int event, struct rt_wlan_buff *buff, void
     {
         rt_kprintf("Failed to connect SSID : %s \n", ((struct rt_wlan_info *)buff->data)->ssid.val);
     }
+
+    net_state_set(NET_STATE_DOWN);
+    display_request();
 }
 
 /**
@@ -391,6 +722,205 @@ static void print_wlan_information(struct rt_wlan_info *info, int index)
     }
 }
 
+/**
+ * 连接WiFi热点并等待获取IP
+ *
+ * @return 获取IP返回RT_EOK，失败返回错误码
+ */
+static rt_err_t wifi_connect(void)
+{
+    struct rt_wlan_info info;  // WLAN信息结构体
+    rt_err_t result;           // 函数返回值
+
+    net_state_set(NET_STATE_ASSOCIATING);
+
+    /* 优先使用缓存的BSSID/信道定向连接，失败后回退到扫描+连接 */
+    result = wifi_cache_connect(WIFI_SSID, WIFI_PASSWORD);
+    if (result != RT_EOK) {
+        rt_kprintf("Connecting to AP: %s\n", WIFI_SSID);
+        result = rt_wlan_connect(WIFI_SSID, WIFI_PASSWORD);
+    }
+    if (result != RT_EOK) {
+        rt_kprintf("Failed to connect AP!\n");
+        net_state_set(NET_STATE_DOWN);
+        return result;
+    }
+
+    rt_memset(&info, 0, sizeof(struct rt_wlan_info));
+    /* 获取当前连接热点信息 */
+    rt_wlan_get_info(&info);
+    rt_kprintf("Connected to AP information:\n");
+    print_wlan_information(&info, 0);
+
+    /* 等待成功获取IP */
+    result = net_state_wait(NET_STATE_IP_ACQUIRED, rt_tick_from_millisecond(WIFI_IP_TIMEOUT));
+    if (result != RT_EOK) {
+        rt_kprintf("Timeout waiting for IP!\n");
+        rt_wlan_disconnect();
+        net_state_set(NET_STATE_DOWN);
+        return result;
+    }
+
+    rt_kprintf("Network ready!\n");
+
+    /* 确认服务器可达后刷新缓存（复用租约时转入后台DHCP续约） */
+    wifi_cache_verify(rt_tick_from_millisecond(WIFI_VERIFY_TIMEOUT));
+    return RT_EOK;
+}
+
+/**
+ * msh命令：查看显示刷新统计/切换绘制方式
+ *
+ * 用法：display [sync|async|reset]
+ * sync为在传感器线程中持锁同步绘制（旧方式），async为交由显示线程合并绘制。
+ */
+static int display_cmd(int argc, char **argv)
+{
+    if (argc > 1) {
+        if (rt_strcmp(argv[1], "sync") == 0) {
+            display_sync = RT_TRUE;
+        } else if (rt_strcmp(argv[1], "async") == 0) {
+            display_sync = RT_FALSE;
+        } else if (rt_strcmp(argv[1], "reset") != 0) {
+            rt_kprintf("usage: display [sync|async|reset]\n");
+            return -1;
+        }
+        /* 切换方式后重新统计 */
+        display_requests = 0;
+        display_frames = 0;
+        aht20_block_max = 0;
+        ap3216c_block_max = 0;
+    }
+
+    rt_kprintf("mode              : %s\n", display_sync ? "sync (in sensor threads)" : "async (display thread)");
+    rt_kprintf("requests / frames : %d / %d\n", display_requests, display_frames);
+    rt_kprintf("aht20 max block   : %d us\n", aht20_block_max);
+    rt_kprintf("ap3216c max block : %d us\n", ap3216c_block_max);
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(display_cmd, display, show LCD refresh stats or switch sync/async drawing);
+
+/**
+ * msh命令：数值字段刷新耗时测试
+ *
+ * 用法：glyph_bench [次数]
+ * 在温度字段位置反复绘制5位数字，比较驱动光栅化、帧缓冲光栅化、
+ * 字形缓存写屏和字形缓存写帧缓冲四种方式的单次耗时，结束后重绘各字段。
+ */
+static int glyph_bench(int argc, char **argv)
+{
+    const char *digits = "12345";       // 测试用5位数字
+    int rounds = 100;                   // 测试次数
+    int i, mode;
+    rt_uint32_t begin, cycles;          // 周期计数
+    rt_uint16_t x = 10 + 9 * 12;        // 数值部分X坐标（"Temp(C): "之后）
+    const char *names[] = {
+        "lcd_show_string      ",
+        "fb rasterize         ",
+        "glyph cache -> panel ",
+        "glyph cache -> fb    ",
+    };
+
+    if (argc > 1) {
+        rounds = atoi(argv[1]);
+    }
+    if (rounds <= 0) {
+        rounds = 1;
+    }
+
+    for (mode = 0; mode < 4; mode++) {
+#ifdef LCD_USING_FRAMEBUFFER
+        if ((mode == 1 || mode == 3) && !lcd_fb_ready()) {
+            continue;
+        }
+#else
+        if (mode == 1 || mode == 3) {
+            continue;
+        }
+#endif
+        begin = DWT->CYCCNT;
+        for (i = 0; i < rounds; i++) {
+            switch (mode) {
+            case 0:
+                lcd_set_color(WHITE, BLACK);
+                lcd_show_string(x, 120, 24, "%s", digits);
+                break;
+            case 2:
+                lcd_glyph_show(x, 120, digits, WHITE, BLACK);
+                break;
+#ifdef LCD_USING_FRAMEBUFFER
+            case 1:
+                /* 背景色取与缓存不同的值，强制走光栅化 */
+                lcd_fb_string(x, 120, 24, digits, WHITE - 1, BLACK);
+                break;
+            default:
+                lcd_fb_string(x, 120, 24, digits, WHITE, BLACK);
+                break;
+#endif
+            }
+        }
+        cycles = DWT->CYCCNT - begin;
+        rt_kprintf("%s: %d us/field\n", names[mode], cycles / rounds / (SystemCoreClock / 1000000));
+    }
+
+    /* 恢复显示（直接写屏绕过了帧缓冲，需标记该区域重新刷新） */
+#ifdef LCD_USING_FRAMEBUFFER
+    lcd_fb_fill(x, 120, 5 * 12, 24, WHITE);
+#endif
+    lcd_text_invalidate(&temp_text);
+    lcd_text_invalidate(&humi_text);
+    lcd_text_invalidate(&light_text);
+    lcd_text_invalidate(&net_text);
+    display_request();
+
+    return 0;
+}
+MSH_CMD_EXPORT(glyph_bench, compare numeric field draw time with and without glyph cache);
+
+/**
+ * msh命令：开机logo绘制耗时测试
+ *
+ * 分别测量RLE解码直接写屏、相同像素数的纯写屏（原lcd_show_image的总线开销）
+ * 以及解码到帧缓冲的耗时。
+ */
+static int logo_bench(int argc, char **argv)
+{
+    rt_uint32_t begin, decode_panel, raw_panel;  // 周期计数
+    rt_uint32_t cycles_per_us = SystemCoreClock / 1000000;
+    rt_uint32_t i;
+
+    begin = DWT->CYCCNT;
+    lcd_rle_show(0, 0, &image_rttlogo);
+    decode_panel = DWT->CYCCNT - begin;
+
+    begin = DWT->CYCCNT;
+    lcd_address_set(0, 0, image_rttlogo.width - 1, image_rttlogo.height - 1);
+    for (i = 0; i < (rt_uint32_t)image_rttlogo.width * image_rttlogo.height; i++) {
+        *(volatile rt_uint16_t *)LCD_DATA_ADDR = WHITE;
+    }
+    raw_panel = DWT->CYCCNT - begin;
+
+    rt_kprintf("logo %dx%d, %d bytes RLE (raw %d bytes)\n", image_rttlogo.width, image_rttlogo.height,
+               image_rttlogo.size, image_rttlogo.width * image_rttlogo.height * 2);
+    rt_kprintf("rle decode -> panel : %d us\n", decode_panel / cycles_per_us);
+    rt_kprintf("raw pixel push      : %d us\n", raw_panel / cycles_per_us);
+
+#ifdef LCD_USING_FRAMEBUFFER
+    if (lcd_fb_ready()) {
+        begin = DWT->CYCCNT;
+        lcd_fb_rle_image(0, 0, &image_rttlogo);
+        rt_kprintf("rle decode -> fb    : %d us\n", (DWT->CYCCNT - begin) / cycles_per_us);
+        lcd_fb_flush();
+        return 0;
+    }
+#endif
+    lcd_rle_show(0, 0, &image_rttlogo);
+
+    return 0;
+}
+MSH_CMD_EXPORT(logo_bench, measure boot logo draw time);
+
 /**
  * 主函数：系统初始化与多线程启动
  *
@@ -398,25 +928,41 @@ static void print_wlan_information(struct rt_wlan_info *info, int index)
  */
 int main(void)
 {
-    rt_thread_t aht20_tid, ap3216c_tid, http_tid;  // 线程ID
-    struct rt_wlan_info info;                     // WLAN信息结构体
-    rt_err_t result;                              // 函数返回值
+    rt_thread_t aht20_tid, ap3216c_tid, http_tid, display_tid;  // 线程ID
+    int wait_ms = 0;                               // 等待WiFi就绪的时间
 
-    /* 初始化LCD */
-    lcd_clear(WHITE);
+    boot_mark(BOOT_MAIN);
 
-    /* 设置背景色和前景色 */
-    lcd_set_color(WHITE, BLACK);
+    /* 建立CCM和外部SRAM内存堆，帧缓冲等大块数据从外部SRAM分配 */
+    if (mem_region_init() != RT_EOK) {
+        rt_kprintf("Failed to init memory regions!\n");
+    }
+    if (web_pool_init() != RT_EOK) {
+        rt_kprintf("Failed to init webclient pools!\n");
+    }
 
-    /* 显示RT-Thread logo */
-    lcd_show_image(0, 0, 240, 69, image_rttlogo);
+    /* 循环中的日志改由低优先级线程输出，采集和上传线程不再等待串口 */
+    if (dlog_init() != RT_EOK) {
+        rt_kprintf("Failed to start deferred logger!\n");
+    }
 
-    /* 在LCD上显示标题 */
-    lcd_show_string(10, 69, 16, "Hello, World!");
-    lcd_show_string(10, 69 + 16, 24, "Sensors Monitoring:");
+    /* 启用DWT周期计数器，供各阶段耗时剖析使用 */
+    perf_init();
 
-    /* 绘制分隔线 */
-    lcd_draw_line(0, 69 + 16 + 24, 240, 69 + 16 + 24);
+    /* 尽早安装调度器钩子，使各线程从创建起就被统计 */
+    if (cpu_mon_init() != RT_EOK) {
+        rt_kprintf("Failed to start CPU monitor!\n");
+    }
+
+    /* 安装事件跟踪钩子（默认关闭，用trace start开始抓取） */
+    if (trace_init() != RT_EOK) {
+        rt_kprintf("Failed to init event trace!\n");
+    }
+
+#ifdef BOOT_USING_SERIAL_START
+    /* 旧顺序：先画完开机画面再启动各线程 */
+    display_splash();
+#endif
 
     /* 创建保护共享数据的互斥锁 */
     g_sensor_mutex = rt_mutex_create("sensor_mutex", RT_IPC_FLAG_FIFO);
@@ -425,13 +971,37 @@ int main(void)
         return -1;
     }
 
-    /* 创建保护网络状态的互斥锁 */
-    net_state_mutex = rt_mutex_create("net_mutex", RT_IPC_FLAG_FIFO);
-    if (net_state_mutex == RT_NULL) {
-        rt_kprintf("Failed to create network mutex!\n");
+    /* 创建显示刷新事件 */
+    rt_event_init(&display_evt, "disp_evt", RT_IPC_FLAG_PRIO);
+
+    /* 初始化网络连接状态机 */
+    if (net_state_init() != RT_EOK) {
+        rt_kprintf("Failed to init network state!\n");
         return -1;
     }
 
+    /* 启动背光与显示电源管理 */
+    if (disp_power_init(display_request) != RT_EOK) {
+        rt_kprintf("[MAIN] Display power manager startup failed\n");
+    }
+
+    /* 无性能申请时降到最低档，绘制、上传时按需升频 */
+    if (clock_scale_init() != RT_EOK) {
+        rt_kprintf("[MAIN] Clock scaling startup failed\n");
+    }
+    /* 启动期间（到首次连接WiFi完成）保持满速，缩短关键路径 */
+    clock_scale_request(CLOCK_LEVEL_HIGH);
+
+    /* 空闲时按下一个定时器到期时刻进入STOP模式（屏幕休眠后生效） */
+    if (lowpower_init() != RT_EOK) {
+        rt_kprintf("[MAIN] Low-power idle startup failed\n");
+    }
+
+    /* 启动服务器可达性探测 */
+    if (net_probe_start(SERVER_IP, SERVER_PORT) != RT_EOK) {
+        rt_kprintf("[MAIN] Network probe startup failed\n");
+    }
+
     /* 创建AHT20读取线程 */
     aht20_tid = rt_thread_create("aht20",
                                 aht20_read_thread_entry,
@@ -448,6 +1018,14 @@ int main(void)
                                   THREAD_PRIORITY,
                                   THREAD_TIMESLICE);
 
+    /* 创建LCD刷新线程（优先级介于采集与上传之间） */
+    display_tid = rt_thread_create("display",
+                                  display_thread_entry,
+                                  RT_NULL,
+                                  DISPLAY_STACK_SIZE,
+                                  THREAD_PRIORITY + 1,
+                                  THREAD_TIMESLICE);
+
     /* 创建HTTP上传线程（增大堆栈到8192字节） */
     http_tid = rt_thread_create("http_upload",
                                http_upload_thread_entry,
@@ -469,59 +1047,49 @@ int main(void)
         rt_kprintf("[MAIN] AP3216C thread startup failed\n");
     }
 
+    if (display_tid != RT_NULL) {
+        rt_thread_startup(display_tid);
+    } else {
+        rt_kprintf("[MAIN] Display thread startup failed\n");
+    }
+
     if (http_tid != RT_NULL) {
         rt_thread_startup(http_tid);
     } else {
         rt_kprintf("[MAIN] HTTP upload thread startup failed\n");
     }
 
-    /* 初始化网络同步信号量 */
-    rt_sem_init(&net_ready, "net_ready", 0, RT_IPC_FLAG_FIFO);
-
     /* 注册网络事件回调函数 */
     rt_wlan_register_event_handler(RT_WLAN_EVT_READY, wlan_ready_handler, RT_NULL);
     rt_wlan_register_event_handler(RT_WLAN_EVT_STA_DISCONNECTED, wlan_station_disconnect_handler, RT_NULL);
     rt_wlan_register_event_handler(RT_WLAN_EVT_STA_CONNECTED, wlan_connect_handler, RT_NULL);
     rt_wlan_register_event_handler(RT_WLAN_EVT_STA_CONNECTED_FAIL, wlan_connect_fail_handler, RT_NULL);
 
-    /* 等待500ms以便WiFi完成初始化 */
-    rt_thread_mdelay(500);
+    /* 等待WiFi模块就绪（最多500ms），就绪后立即连接 */
+    while (rt_wlan_get_mode(RT_WLAN_DEVICE_STA_NAME) != RT_WLAN_STATION && wait_ms < WIFI_INIT_TIMEOUT) {
+        rt_thread_mdelay(10);
+        wait_ms += 10;
+    }
 
     /* 连接WiFi热点 */
-    rt_kprintf("Connecting to AP: iQOO Neo9\n");
-    result = rt_wlan_connect("iQOO Neo9", "1234567890");
-    if (result == RT_EOK) {
-        rt_memset(&info, 0, sizeof(struct rt_wlan_info));
-        /* 获取当前连接热点信息 */
-        rt_wlan_get_info(&info);
-        rt_kprintf("Connected to AP information:\n");
-        print_wlan_information(&info, 0);
-
-        /* 等待成功获取IP */
-        result = rt_sem_take(&net_ready, rt_tick_from_millisecond(15000));
-        if (result == RT_EOK) {
-            rt_kprintf("Network ready!\n");
-            msh_exec("ifconfig", rt_strlen("ifconfig"));
-        } else {
-            rt_kprintf("Timeout waiting for IP!\n");
-        }
-    } else {
-        rt_kprintf("Failed to connect AP!\n");
+#ifdef BOOT_USING_SERIAL_START
+    if (wifi_connect() == RT_EOK) {
+        msh_exec("ifconfig", rt_strlen("ifconfig"));
     }
+#else
+    /* 不再调用ifconfig：main线程优先级最高，整屏输出会阻塞采集和上传线程数十毫秒 */
+    wifi_connect();
+#endif
+    clock_scale_release(CLOCK_LEVEL_HIGH);
 
-    /* 主线程循环 */
+    /* 主线程循环：阻塞等待断线事件，断线后立即重连 */
     while (1) {
-        /* 每5秒检查一次网络连接状态 */
-        int connected;
-        rt_mutex_take(net_state_mutex, RT_WAITING_FOREVER);
-        connected = network_connected;
-        rt_mutex_release(net_state_mutex);
-
-        if (!connected) {
-            rt_kprintf("Attempting to reconnect to AP...\n");
-            rt_wlan_connect("iQOO Neo9", "1234567890");
+        net_state_wait(NET_STATE_DOWN, RT_WAITING_FOREVER);
+
+        rt_kprintf("Attempting to reconnect to AP...\n");
+        if (wifi_connect() != RT_EOK) {
+            rt_thread_mdelay(WIFI_RETRY_INTERVAL);
         }
-        rt_thread_mdelay(5000);
     }
 
     return 0;
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         多区域内存分配（片内SRAM/CCM/外部SRAM）
+ */
+
+#include "mem_region.h"    // 多区域内存分配头文件
+#include <board.h>         // 各内存区域地址
+
+#ifndef RT_USING_MEMHEAP
+#error "mem_region requires RT_USING_MEMHEAP"
+#endif
+
+/* 每个区域的分配统计 */
+struct mem_region_stat {
+    rt_uint32_t allocs;     // 成功分配次数
+    rt_uint32_t fallbacks;  // 因首选区域不足而落到本区域的次数
+    rt_uint32_t fails;      // 本区域分配失败次数
+};
+
+static struct rt_memheap ccm_heap;         // CCM堆
+#ifdef BSP_USING_SRAM
+static struct rt_memheap ext_heap;         // 外部SRAM堆
+#endif
+static rt_bool_t region_ready[MEM_HINT_MAX];
+static struct mem_region_stat region_stats[MEM_HINT_MAX];
+
+static const char *region_names[MEM_HINT_MAX] = {"ccm", "sram", "extsram"};
+
+/* 各提示的回退顺序，MEM_HINT_MAX结束 */
+static const mem_hint_t fallback_order[MEM_HINT_MAX][MEM_HINT_MAX] = {
+    [MEM_HINT_FAST]  = {MEM_HINT_FAST, MEM_HINT_DMA, MEM_HINT_LARGE},
+    [MEM_HINT_DMA]   = {MEM_HINT_DMA, MEM_HINT_LARGE, MEM_HINT_MAX},
+    [MEM_HINT_LARGE] = {MEM_HINT_LARGE, MEM_HINT_MAX, MEM_HINT_MAX},
+};
+
+/**
+ * 获取区域对应的memheap（系统堆返回RT_NULL）
+ */
+static struct rt_memheap *mem_region_heap(mem_hint_t region)
+{
+    if (region == MEM_HINT_FAST) {
+        return &ccm_heap;
+    }
+#ifdef BSP_USING_SRAM
+    if (region == MEM_HINT_LARGE) {
+        return &ext_heap;
+    }
+#endif
+    return RT_NULL;
+}
+
+/**
+ * 在CCM和外部SRAM的空闲部分上建立内存堆
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t mem_region_init(void)
+{
+    rt_err_t result;
+
+    region_ready[MEM_HINT_DMA] = RT_TRUE;
+
+    result = rt_memheap_init(&ccm_heap, "ccm", CCM_HEAP_BEGIN,
+                             (rt_ubase_t)CCM_HEAP_END - (rt_ubase_t)CCM_HEAP_BEGIN);
+    if (result != RT_EOK) {
+        rt_kprintf("[MEM] CCM heap init failed\n");
+        return result;
+    }
+    region_ready[MEM_HINT_FAST] = RT_TRUE;
+
+#ifdef BSP_USING_SRAM
+    result = rt_memheap_init(&ext_heap, "extsram", EXT_SRAM_HEAP_BEGIN,
+                             (rt_ubase_t)EXT_SRAM_HEAP_END - (rt_ubase_t)EXT_SRAM_HEAP_BEGIN);
+    if (result != RT_EOK) {
+        rt_kprintf("[MEM] External SRAM heap init failed\n");
+        return result;
+    }
+    region_ready[MEM_HINT_LARGE] = RT_TRUE;
+#endif
+
+    return RT_EOK;
+}
+
+/**
+ * 按放置提示分配内存
+ *
+ * @param hint 放置提示
+ * @param size 字节数
+ * @return 成功返回内存地址，失败返回RT_NULL
+ */
+void *mem_region_alloc(mem_hint_t hint, rt_size_t size)
+{
+    struct rt_memheap *heap;
+    mem_hint_t region;
+    void *ptr;
+    int i;
+
+    RT_ASSERT(hint < MEM_HINT_MAX);
+
+    for (i = 0; i < MEM_HINT_MAX && fallback_order[hint][i] != MEM_HINT_MAX; i++) {
+        region = fallback_order[hint][i];
+        if (!region_ready[region]) {
+            continue;
+        }
+
+        heap = mem_region_heap(region);
+        ptr = heap ? rt_memheap_alloc(heap, size) : rt_malloc(size);
+        if (ptr != RT_NULL) {
+            region_stats[region].allocs++;
+            if (region != hint) {
+                region_stats[region].fallbacks++;
+            }
+            return ptr;
+        }
+        region_stats[region].fails++;
+    }
+
+    return RT_NULL;
+}
+
+/**
+ * 释放mem_region_alloc分配的内存（按地址判断所属区域）
+ *
+ * @param ptr 内存地址，可为RT_NULL
+ */
+void mem_region_free(void *ptr)
+{
+    rt_ubase_t addr = (rt_ubase_t)ptr;
+
+    if (ptr == RT_NULL) {
+        return;
+    }
+
+    if ((addr >= STM32_CCMRAM_BEGIN && addr < STM32_CCMRAM_END)
+            || (addr >= STM32_EXT_SRAM_BEGIN && addr < STM32_EXT_SRAM_END)) {
+        rt_memheap_free(ptr);
+    } else {
+        rt_free(ptr);
+    }
+}
+
+/**
+ * 统计memheap的空闲块数量和最大空闲块
+ */
+static void mem_region_scan(struct rt_memheap *heap, rt_uint32_t *blocks, rt_uint32_t *largest)
+{
+    struct rt_memheap_item *item;
+    rt_uint32_t size;  // 空闲块可用字节数
+
+    *blocks = 0;
+    *largest = 0;
+
+    /* 块大小由相邻块头的地址差减去块头得到（memheap.c中的MEMITEM_SIZE不对外公开） */
+    rt_sem_take(&heap->lock, RT_WAITING_FOREVER);
+    for (item = heap->free_list->next_free; item != heap->free_list; item = item->next_free) {
+        (*blocks)++;
+        size = (rt_ubase_t)item->next - (rt_ubase_t)item - sizeof(struct rt_memheap_item);
+        if (size > *largest) {
+            *largest = size;
+        }
+    }
+    rt_sem_release(&heap->lock);
+}
+
+/**
+ * msh命令：输出各内存区域的使用量和碎片情况
+ *
+ * 碎片率 = 1 - 最大空闲块 / 空闲总量，接近0表示空闲内存基本连续。
+ * 系统堆（small mem）不公开空闲链表，只输出用量。
+ */
+static int memregion(int argc, char **argv)
+{
+    struct rt_memheap *heap;
+    rt_size_t total, used, max_used;
+    rt_uint32_t blocks, largest, free;
+    int i;
+
+    rt_kprintf("%-8s %8s %8s %8s %8s %7s %9s %6s %6s %6s\n", "region", "total", "used", "max", "largest",
+               "blocks", "frag", "alloc", "fallbk", "fail");
+    for (i = 0; i < MEM_HINT_MAX; i++) {
+        if (!region_ready[i]) {
+            rt_kprintf("%-8s (not available)\n", region_names[i]);
+            continue;
+        }
+
+        heap = mem_region_heap((mem_hint_t)i);
+        if (heap != RT_NULL) {
+            total = heap->pool_size;
+            used = heap->pool_size - heap->available_size;
+            max_used = heap->max_used_size;
+            mem_region_scan(heap, &blocks, &largest);
+            free = heap->available_size;
+            rt_kprintf("%-8s %8d %8d %8d %8d %7d %8d%% %6d %6d %6d\n", region_names[i], total, used, max_used,
+                       largest, blocks, free ? 100 - largest * 100 / free : 0,
+                       region_stats[i].allocs, region_stats[i].fallbacks, region_stats[i].fails);
+        } else {
+            rt_memory_info(&total, &used, &max_used);
+            rt_kprintf("%-8s %8d %8d %8d %8s %7s %9s %6d %6d %6d\n", region_names[i], total, used, max_used,
+                       "-", "-", "-", region_stats[i].allocs, region_stats[i].fallbacks, region_stats[i].fails);
+        }
+    }
+
+    return 0;
+}
+MSH_CMD_EXPORT(memregion, show per-region heap usage and fragmentation);
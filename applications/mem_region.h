@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         多区域内存分配（片内SRAM/CCM/外部SRAM）
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __MEM_REGION_H__
+#define __MEM_REGION_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 内存放置提示 */
+typedef enum {
+    MEM_HINT_FAST = 0,      // CCM：零等待、仅CPU可访问（不能作DMA缓冲），用于小而频繁访问的对象
+    MEM_HINT_DMA,           // 片内SRAM（系统堆）：DMA可访问，用于外设收发缓冲
+    MEM_HINT_LARGE,         // 外部SRAM：容量大、访问较慢，用于历史数据和帧缓冲
+    MEM_HINT_MAX
+} mem_hint_t;
+
+/**
+ * 在CCM和外部SRAM的空闲部分上建立内存堆
+ *
+ * 必须在使用MEM_HINT_FAST/MEM_HINT_LARGE分配之前调用（main开始处）。
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t mem_region_init(void);
+
+/**
+ * 按放置提示分配内存
+ *
+ * 首选区域不足时依次退到：FAST→DMA→LARGE，DMA→LARGE；LARGE不回退，
+ * 以免大块分配挤占片内SRAM。
+ *
+ * @param hint 放置提示
+ * @param size 字节数
+ * @return 成功返回内存地址，失败返回RT_NULL
+ */
+void *mem_region_alloc(mem_hint_t hint, rt_size_t size);
+
+/**
+ * 释放mem_region_alloc分配的内存（按地址判断所属区域）
+ *
+ * @param ptr 内存地址，可为RT_NULL
+ */
+void mem_region_free(void *ptr);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         服务器可达性探测
+ */
+
+#include "net_probe.h"     // 可达性探测头文件
+#include "net_state.h"     // 网络连接状态机
+#include <rtdevice.h>      // RT设备驱动框架
+
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+/* 探测线程参数 */
+#define PROBE_THREAD_STACK_SIZE  1536   // 探测线程栈大小
+#define PROBE_THREAD_PRIORITY    26     // 低于传感器线程，高于上传线程
+#define PROBE_THREAD_TIMESLICE   5      // 线程时间片
+
+/* 探测策略 */
+#define PROBE_TIMEOUT_MS         1000   // 单次TCP连接超时(ms)
+#define PROBE_FAST_INTERVAL      500    // 服务器不可达时的探测间隔(ms)
+#define PROBE_SLOW_INTERVAL      5000   // 服务器可达时的保活探测间隔(ms)
+#define PROBE_LOSS_THRESHOLD     3      // 连续丢失多少次判定为不可达
+#define PROBE_WINDOW             64     // 滚动统计窗口（探测次数）
+
+#define PROBE_LOST               (-1)   // 窗口中表示丢失的RTT值
+
+/* RTT直方图桶上限(ms)，最后一个桶统计超过最大上限的样本 */
+static const rt_uint16_t probe_bucket_limit[] = {5, 10, 20, 50, 100, 200, 500};
+#define PROBE_BUCKETS  (sizeof(probe_bucket_limit) / sizeof(probe_bucket_limit[0]) + 1)
+
+/* 探测统计数据 */
+struct probe_stats {
+    rt_int16_t window[PROBE_WINDOW];    // 最近PROBE_WINDOW次探测的RTT(ms)，丢失为PROBE_LOST
+    rt_uint16_t window_pos;             // 下一个写入位置
+    rt_uint16_t window_cnt;             // 窗口内有效样本数
+    rt_uint32_t sent;                   // 累计探测次数
+    rt_uint32_t lost;                   // 累计丢失次数
+};
+
+static struct probe_stats probe_stats;         // 统计数据
+static rt_mutex_t probe_mutex = RT_NULL;       // 保护统计数据的互斥锁
+static struct sockaddr_in probe_addr;          // 探测目标地址
+
+/**
+ * 对服务器端口发起一次非阻塞TCP连接
+ *
+ * @return 连接成功返回RTT(ms)，失败或超时返回PROBE_LOST
+ */
+static int probe_once(void)
+{
+    int sock;                       // 套接字
+    int rtt = PROBE_LOST;           // 本次RTT
+    int sock_err = 0;               // 套接字错误码
+    socklen_t len = sizeof(sock_err);
+    fd_set wset;                    // 可写集合
+    struct timeval tv;              // select超时
+    rt_tick_t start;                // 起始时刻
+
+    sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (sock < 0) {
+        return PROBE_LOST;
+    }
+    fcntl(sock, F_SETFL, O_NONBLOCK);
+
+    start = rt_tick_get();
+    if (connect(sock, (struct sockaddr *)&probe_addr, sizeof(probe_addr)) == 0) {
+        rtt = (rt_tick_get() - start) * 1000 / RT_TICK_PER_SECOND;
+    } else if (errno == EINPROGRESS) {
+        FD_ZERO(&wset);
+        FD_SET(sock, &wset);
+        tv.tv_sec = PROBE_TIMEOUT_MS / 1000;
+        tv.tv_usec = (PROBE_TIMEOUT_MS % 1000) * 1000;
+
+        /* 连接完成时套接字可写，再通过SO_ERROR区分成功与拒绝 */
+        if (select(sock + 1, RT_NULL, &wset, RT_NULL, &tv) > 0
+                && getsockopt(sock, SOL_SOCKET, SO_ERROR, &sock_err, &len) == 0
+                && sock_err == 0) {
+            rtt = (rt_tick_get() - start) * 1000 / RT_TICK_PER_SECOND;
+        }
+    }
+
+    close(sock);
+    return rtt;
+}
+
+/**
+ * 记录一次探测结果
+ *
+ * @param rtt 探测RTT(ms)，丢失为PROBE_LOST
+ */
+static void probe_record(int rtt)
+{
+    rt_mutex_take(probe_mutex, RT_WAITING_FOREVER);
+    probe_stats.window[probe_stats.window_pos] = (rt_int16_t)(rtt > 0x7FFF ? 0x7FFF : rtt);
+    probe_stats.window_pos = (probe_stats.window_pos + 1) % PROBE_WINDOW;
+    if (probe_stats.window_cnt < PROBE_WINDOW) {
+        probe_stats.window_cnt++;
+    }
+    probe_stats.sent++;
+    if (rtt == PROBE_LOST) {
+        probe_stats.lost++;
+    }
+    rt_mutex_release(probe_mutex);
+}
+
+/**
+ * 探测线程入口函数
+ *
+ * @param parameter 线程参数
+ */
+static void net_probe_thread_entry(void *parameter)
+{
+    int rtt;                        // 本次RTT
+    int consecutive_lost = 0;       // 连续丢失次数
+    int interval;                   // 下次探测间隔
+
+    while (1) {
+        /* 未获取IP时阻塞等待 */
+        if (net_state_wait(NET_STATE_IP_ACQUIRED, RT_WAITING_FOREVER) != RT_EOK) {
+            continue;
+        }
+
+        rtt = probe_once();
+        probe_record(rtt);
+
+        if (rtt != PROBE_LOST) {
+            consecutive_lost = 0;
+            net_state_change(NET_STATE_IP_ACQUIRED, NET_STATE_REACHABLE);
+        } else if (++consecutive_lost >= PROBE_LOSS_THRESHOLD) {
+            net_state_change(NET_STATE_REACHABLE, NET_STATE_IP_ACQUIRED);
+        }
+
+        interval = (net_state_get() == NET_STATE_REACHABLE) ? PROBE_SLOW_INTERVAL : PROBE_FAST_INTERVAL;
+
+        /* 等待下一次探测，期间断线则立即返回重新等待IP */
+        if (net_state_wait(NET_STATE_DOWN, rt_tick_from_millisecond(interval)) == RT_EOK) {
+            consecutive_lost = 0;
+        }
+    }
+}
+
+/**
+ * 启动服务器可达性探测线程
+ *
+ * @param server_ip   服务器IP地址
+ * @param server_port 服务器端口
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t net_probe_start(const char *server_ip, int server_port)
+{
+    rt_thread_t tid;  // 线程ID
+
+    RT_ASSERT(server_ip != RT_NULL);
+
+    rt_memset(&probe_addr, 0, sizeof(probe_addr));
+    probe_addr.sin_family = AF_INET;
+    probe_addr.sin_port = htons(server_port);
+    probe_addr.sin_addr.s_addr = inet_addr(server_ip);
+
+    probe_mutex = rt_mutex_create("probe", RT_IPC_FLAG_PRIO);
+    if (probe_mutex == RT_NULL) {
+        return -RT_ENOMEM;
+    }
+
+    tid = rt_thread_create("net_probe",
+                           net_probe_thread_entry,
+                           RT_NULL,
+                           PROBE_THREAD_STACK_SIZE,
+                           PROBE_THREAD_PRIORITY,
+                           PROBE_THREAD_TIMESLICE);
+    if (tid == RT_NULL) {
+        return -RT_ENOMEM;
+    }
+
+    return rt_thread_startup(tid);
+}
+
+/**
+ * msh命令：显示滚动RTT及丢包统计，"probe reset"清空统计
+ */
+static int probe_cmd(int argc, char **argv)
+{
+    struct probe_stats stats;                   // 统计快照
+    rt_uint32_t hist[PROBE_BUCKETS] = {0};      // 窗口RTT直方图
+    rt_uint32_t window_lost = 0;                // 窗口内丢失次数
+    rt_uint32_t rtt_sum = 0, rtt_cnt = 0;       // RTT累加
+    int rtt_min = 0x7FFF, rtt_max = 0;          // RTT极值
+    rt_uint32_t i, b;
+
+    if (probe_mutex == RT_NULL) {
+        rt_kprintf("probe not started\n");
+        return -1;
+    }
+
+    rt_mutex_take(probe_mutex, RT_WAITING_FOREVER);
+    if (argc > 1 && rt_strcmp(argv[1], "reset") == 0) {
+        rt_memset(&probe_stats, 0, sizeof(probe_stats));
+    }
+    stats = probe_stats;
+    rt_mutex_release(probe_mutex);
+
+    for (i = 0; i < stats.window_cnt; i++) {
+        int rtt = stats.window[i];
+
+        if (rtt == PROBE_LOST) {
+            window_lost++;
+            continue;
+        }
+        rtt_sum += rtt;
+        rtt_cnt++;
+        if (rtt < rtt_min) rtt_min = rtt;
+        if (rtt > rtt_max) rtt_max = rtt;
+
+        for (b = 0; b < PROBE_BUCKETS - 1 && rtt >= probe_bucket_limit[b]; b++);
+        hist[b]++;
+    }
+
+    rt_kprintf("target  : %s:%d (state %s)\n", inet_ntoa(probe_addr.sin_addr),
+               ntohs(probe_addr.sin_port), net_state_name(net_state_get()));
+    rt_kprintf("total   : sent %d, lost %d\n", stats.sent, stats.lost);
+    rt_kprintf("window  : %d probes, loss %d%%\n", stats.window_cnt,
+               stats.window_cnt ? window_lost * 100 / stats.window_cnt : 0);
+    if (rtt_cnt > 0) {
+        rt_kprintf("rtt (ms): min %d, avg %d, max %d\n", rtt_min, rtt_sum / rtt_cnt, rtt_max);
+    }
+    for (b = 0; b < PROBE_BUCKETS; b++) {
+        if (b < PROBE_BUCKETS - 1) {
+            rt_kprintf("  <%4d ms: %d\n", probe_bucket_limit[b], hist[b]);
+        } else {
+            rt_kprintf("  >=%3d ms: %d\n", probe_bucket_limit[b - 1], hist[b]);
+        }
+    }
+    rt_kprintf("  lost    : %d\n", window_lost);
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(probe_cmd, probe, show upload server RTT and loss histogram);
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         服务器可达性探测
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __NET_PROBE_H__
+#define __NET_PROBE_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 启动服务器可达性探测线程
+ *
+ * 探测线程在获取IP后周期性地对服务器端口发起非阻塞TCP连接，
+ * 根据结果切换NET_STATE_IP_ACQUIRED/NET_STATE_REACHABLE状态，
+ * 并记录滚动RTT及丢包统计（msh命令：probe）。
+ *
+ * @param server_ip   服务器IP地址
+ * @param server_port 服务器端口
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t net_probe_start(const char *server_ip, int server_port);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
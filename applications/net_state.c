@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         网络连接状态机
+ */
+
+#include "net_state.h"     // 网络状态机头文件
+#include <rtdevice.h>      // RT设备驱动框架
+#include "boot_time.h"     // 启动里程碑
+
+#define NET_EVT_ALL  (NET_EVT_BIT(NET_STATE_MAX) - 1)  // 全部状态事件位
+
+/* 状态机私有数据 */
+static struct rt_event net_state_event;        // 状态事件集，消费者阻塞于此
+static rt_mutex_t net_state_mutex = RT_NULL;   // 保护状态及统计数据的互斥锁
+static net_state_t net_state = NET_STATE_DOWN; // 当前状态
+
+/* 重连到首次上传延迟统计 */
+static rt_tick_t ip_acquired_tick = 0;         // 最近一次获取IP的时刻
+static rt_bool_t upload_pending = RT_FALSE;    // 获取IP后是否尚未完成首次上传
+static rt_uint32_t reconnect_count = 0;        // 获取IP的次数
+static rt_uint32_t last_latency_ms = 0;        // 最近一次重连到首次上传的延迟
+static rt_uint32_t max_latency_ms = 0;         // 最大延迟
+
+/* 启动/断线到获取IP的耗时统计 */
+static rt_uint32_t boot_to_ip_ms = 0;          // 上电到首次获取IP的耗时，0表示尚未获取
+static rt_tick_t link_down_tick = 0;           // 最近一次断线时刻
+static rt_bool_t link_down_valid = RT_FALSE;   // 断线时刻是否有效
+static rt_uint32_t drop_to_ip_ms = 0;          // 最近一次断线到重新获取IP的耗时
+static rt_uint32_t drop_to_ip_max_ms = 0;      // 断线到重新获取IP的最大耗时
+
+static const char *const net_state_names[NET_STATE_MAX] = {
+    "DOWN", "ASSOCIATING", "IP_ACQUIRED", "REACHABLE"
+};
+
+/**
+ * 初始化网络状态机
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t net_state_init(void)
+{
+    net_state_mutex = rt_mutex_create("net_mutex", RT_IPC_FLAG_PRIO);
+    if (net_state_mutex == RT_NULL) {
+        return -RT_ENOMEM;
+    }
+
+    rt_event_init(&net_state_event, "net_evt", RT_IPC_FLAG_PRIO);
+    rt_event_send(&net_state_event, NET_EVT_BIT(NET_STATE_DOWN));
+
+    return RT_EOK;
+}
+
+/**
+ * 在持有锁的情况下切换状态
+ *
+ * @param state 新状态
+ */
+static void net_state_switch(net_state_t state)
+{
+    net_state_t old_state = net_state;
+
+    net_state = state;
+
+    /* 从未获取IP的状态进入已获取IP状态，开始计时 */
+    if (state >= NET_STATE_IP_ACQUIRED && old_state < NET_STATE_IP_ACQUIRED) {
+        ip_acquired_tick = rt_tick_get();
+        upload_pending = RT_TRUE;
+        reconnect_count++;
+
+        if (boot_to_ip_ms == 0) {
+            boot_to_ip_ms = ip_acquired_tick * 1000 / RT_TICK_PER_SECOND;
+            rt_kprintf("[NET] Boot to IP: %d ms\n", boot_to_ip_ms);
+        } else if (link_down_valid) {
+            drop_to_ip_ms = (ip_acquired_tick - link_down_tick) * 1000 / RT_TICK_PER_SECOND;
+            if (drop_to_ip_ms > drop_to_ip_max_ms) {
+                drop_to_ip_max_ms = drop_to_ip_ms;
+            }
+            rt_kprintf("[NET] Drop to reconnect: %d ms\n", drop_to_ip_ms);
+        }
+        link_down_valid = RT_FALSE;
+    } else if (state < NET_STATE_IP_ACQUIRED) {
+        upload_pending = RT_FALSE;
+
+        /* 从已连接状态掉线，开始计时 */
+        if (old_state >= NET_STATE_IP_ACQUIRED) {
+            link_down_tick = rt_tick_get();
+            link_down_valid = RT_TRUE;
+        }
+    }
+
+    /* 清除旧状态事件位，再置位新状态事件位 */
+    rt_event_recv(&net_state_event, NET_EVT_ALL & ~NET_EVT_BIT(state),
+                  RT_EVENT_FLAG_OR | RT_EVENT_FLAG_CLEAR, 0, RT_NULL);
+    rt_event_send(&net_state_event, NET_EVT_BIT(state));
+
+    rt_kprintf("[NET] State: %s -> %s\n", net_state_names[old_state], net_state_names[state]);
+
+    /* 启动里程碑只记录第一次，重连不影响 */
+    if (state == NET_STATE_ASSOCIATING) {
+        boot_mark(BOOT_WIFI_START);
+    } else if (state == NET_STATE_IP_ACQUIRED) {
+        boot_mark(BOOT_IP_ACQUIRED);
+    } else if (state == NET_STATE_REACHABLE) {
+        boot_mark(BOOT_REACHABLE);
+    }
+}
+
+/**
+ * 切换网络状态，并唤醒等待该状态的线程
+ *
+ * @param state 新状态
+ */
+void net_state_set(net_state_t state)
+{
+    RT_ASSERT(state < NET_STATE_MAX);
+
+    rt_mutex_take(net_state_mutex, RT_WAITING_FOREVER);
+    if (net_state != state) {
+        net_state_switch(state);
+    }
+    rt_mutex_release(net_state_mutex);
+}
+
+/**
+ * 仅当当前状态为from时切换到to，避免覆盖并发发生的状态变化
+ *
+ * @param from 期望的当前状态
+ * @param to   新状态
+ * @return 切换成功返回RT_TRUE
+ */
+rt_bool_t net_state_change(net_state_t from, net_state_t to)
+{
+    rt_bool_t changed = RT_FALSE;
+
+    RT_ASSERT(to < NET_STATE_MAX);
+
+    rt_mutex_take(net_state_mutex, RT_WAITING_FOREVER);
+    if (net_state == from && from != to) {
+        net_state_switch(to);
+        changed = RT_TRUE;
+    }
+    rt_mutex_release(net_state_mutex);
+
+    return changed;
+}
+
+/**
+ * 获取当前网络状态
+ *
+ * @return 当前状态
+ */
+net_state_t net_state_get(void)
+{
+    return net_state;
+}
+
+/**
+ * 阻塞等待网络状态达到指定级别
+ *
+ * @param state   期望的最低状态（NET_STATE_DOWN表示等待断开）
+ * @param timeout 超时时间（tick），RT_WAITING_FOREVER表示一直等待
+ * @return 达到期望状态返回RT_EOK，超时返回-RT_ETIMEOUT
+ */
+rt_err_t net_state_wait(net_state_t state, rt_int32_t timeout)
+{
+    rt_uint32_t set;
+
+    RT_ASSERT(state < NET_STATE_MAX);
+
+    if (state == NET_STATE_DOWN) {
+        set = NET_EVT_BIT(NET_STATE_DOWN);
+    } else {
+        set = NET_EVT_ALL & ~(NET_EVT_BIT(state) - 1);  // 不低于state的所有状态
+    }
+
+    /* 不清除事件位：状态是电平而非脉冲，多个消费者可同时等待 */
+    return rt_event_recv(&net_state_event, set, RT_EVENT_FLAG_OR, timeout, RT_NULL);
+}
+
+/**
+ * 上传成功后调用，用于统计重连到首次上传的延迟
+ */
+void net_state_mark_upload(void)
+{
+    rt_uint32_t latency;
+
+    rt_mutex_take(net_state_mutex, RT_WAITING_FOREVER);
+    if (!upload_pending) {
+        rt_mutex_release(net_state_mutex);
+        return;
+    }
+    upload_pending = RT_FALSE;
+
+    latency = (rt_tick_get() - ip_acquired_tick) * 1000 / RT_TICK_PER_SECOND;
+    last_latency_ms = latency;
+    if (latency > max_latency_ms) {
+        max_latency_ms = latency;
+    }
+    rt_mutex_release(net_state_mutex);
+
+    rt_kprintf("[NET] Reconnect to first upload: %d ms\n", latency);
+}
+
+/**
+ * 获取状态名称字符串
+ *
+ * @param state 状态
+ * @return 状态名称
+ */
+const char *net_state_name(net_state_t state)
+{
+    return (state < NET_STATE_MAX) ? net_state_names[state] : "UNKNOWN";
+}
+
+/**
+ * msh命令：显示网络状态及重连延迟统计
+ */
+static int net_state_cmd(int argc, char **argv)
+{
+    rt_mutex_take(net_state_mutex, RT_WAITING_FOREVER);
+    rt_kprintf("state            : %s\n", net_state_names[net_state]);
+    rt_kprintf("reconnects       : %d\n", reconnect_count);
+    rt_kprintf("boot to IP (ms)  : %d\n", boot_to_ip_ms);
+    rt_kprintf("drop to IP (ms)  : last %d, max %d\n", drop_to_ip_ms, drop_to_ip_max_ms);
+    rt_kprintf("first upload (ms): last %d, max %d%s\n",
+               last_latency_ms, max_latency_ms, upload_pending ? " (pending)" : "");
+    rt_mutex_release(net_state_mutex);
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(net_state_cmd, net_state, show connectivity state and reconnect latency);
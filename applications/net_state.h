@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         网络连接状态机
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __NET_STATE_H__
+#define __NET_STATE_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 网络连接状态（数值越大表示连接越完整） */
+typedef enum {
+    NET_STATE_DOWN = 0,         // 未连接
+    NET_STATE_ASSOCIATING,      // 正在关联热点/等待DHCP
+    NET_STATE_IP_ACQUIRED,      // 已获取IP
+    NET_STATE_REACHABLE,        // 上传服务器可达
+    NET_STATE_MAX
+} net_state_t;
+
+/* 状态对应的事件位，每个时刻只有当前状态的事件位被置位 */
+#define NET_EVT_BIT(state)  (1UL << (state))
+
+/**
+ * 初始化网络状态机
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t net_state_init(void);
+
+/**
+ * 切换网络状态，并唤醒等待该状态的线程
+ *
+ * @param state 新状态
+ */
+void net_state_set(net_state_t state);
+
+/**
+ * 仅当当前状态为from时切换到to，避免覆盖并发发生的状态变化
+ *
+ * @param from 期望的当前状态
+ * @param to   新状态
+ * @return 切换成功返回RT_TRUE
+ */
+rt_bool_t net_state_change(net_state_t from, net_state_t to);
+
+/**
+ * 获取当前网络状态
+ *
+ * @return 当前状态
+ */
+net_state_t net_state_get(void);
+
+/**
+ * 阻塞等待网络状态达到指定级别
+ *
+ * @param state   期望的最低状态（NET_STATE_DOWN表示等待断开）
+ * @param timeout 超时时间（tick），RT_WAITING_FOREVER表示一直等待
+ * @return 达到期望状态返回RT_EOK，超时返回-RT_ETIMEOUT
+ */
+rt_err_t net_state_wait(net_state_t state, rt_int32_t timeout);
+
+/**
+ * 上传成功后调用，用于统计重连到首次上传的延迟
+ */
+void net_state_mark_upload(void);
+
+/**
+ * 获取状态名称字符串
+ *
+ * @param state 状态
+ * @return 状态名称
+ */
+const char *net_state_name(net_state_t state);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         基于DWT周期计数器的性能剖析
+ */
+
+#include "perf.h"  // 性能剖析头文件
+
+#ifdef APP_USING_PERF
+
+/*
+ * 耗时直方图按微秒分桶：0~3us每微秒一个桶，此后每个2的幂区间再分4个子桶，
+ * 相对误差不超过25%，96个桶覆盖到约16秒。
+ */
+#define PERF_SUB_BITS   2
+#define PERF_SUBS       (1 << PERF_SUB_BITS)
+#define PERF_BUCKETS    96
+
+struct perf_stat {
+    rt_uint32_t count;                  // 次数
+    rt_uint32_t min;                    // 最小耗时（us）
+    rt_uint32_t max;                    // 最大耗时（us）
+    rt_uint64_t sum;                    // 总耗时（us）
+    rt_uint16_t hist[PERF_BUCKETS];     // 耗时直方图（us）
+};
+
+static struct perf_stat stats[PERF_STAGE_MAX];
+
+static const char *stage_names[PERF_STAGE_MAX] = {
+    "aht20 i2c send",
+    "aht20 convert",
+    "aht20 i2c recv",
+    "ap3216c read",
+    "lcd draw",
+    "lcd flush",
+    "url format",
+    "http request",
+    "http read",
+    "tls connect",
+    "tls handshake",
+    "tls send",
+    "tls recv",
+};
+
+/**
+ * 计算最高有效位位置
+ */
+static int perf_msb(rt_uint32_t v)
+{
+    int n = 0;
+
+    while (v >>= 1) {
+        n++;
+    }
+    return n;
+}
+
+/**
+ * 微秒值对应的桶号
+ */
+static int perf_bucket(rt_uint32_t us)
+{
+    int msb, idx;
+
+    if (us < PERF_SUBS) {
+        return us;
+    }
+    msb = perf_msb(us);
+    idx = PERF_SUBS * (msb - PERF_SUB_BITS + 1) + ((us >> (msb - PERF_SUB_BITS)) & (PERF_SUBS - 1));
+
+    return idx < PERF_BUCKETS ? idx : PERF_BUCKETS - 1;
+}
+
+/**
+ * 桶的上界（us）
+ */
+static rt_uint32_t perf_bucket_upper(int idx)
+{
+    int shift;
+
+    if (idx < PERF_SUBS) {
+        return idx;
+    }
+    shift = idx / PERF_SUBS - 1;
+    return ((rt_uint32_t)(PERF_SUBS + idx % PERF_SUBS + 1) << shift) - 1;
+}
+
+/**
+ * 启用DWT周期计数器
+ */
+void perf_init(void)
+{
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/**
+ * 获取阶段名称
+ *
+ * @param stage 阶段
+ * @return 阶段名称
+ */
+const char *perf_stage_name(perf_stage_t stage)
+{
+    return (stage < PERF_STAGE_MAX) ? stage_names[stage] : "?";
+}
+
+/**
+ * 记录一次阶段耗时
+ *
+ * 周期数按记录时的主频换算成微秒后再累计。主频随clock_scale档位变化，
+ * 如果累计周期数、输出时再换算，低档位下的样本会按输出时的档位被放大。
+ *
+ * @param stage   阶段
+ * @param elapsed 耗时，PERF_STAGE_WALL的阶段为微秒，其余为CPU周期
+ */
+void perf_record(perf_stage_t stage, rt_uint32_t elapsed)
+{
+    struct perf_stat *st = &stats[stage];
+    rt_uint32_t cycles_per_us = SystemCoreClock / 1000000;
+    rt_uint32_t us;
+    int bucket;
+    rt_base_t level;
+
+    if (PERF_STAGE_WALL(stage)) {
+        us = elapsed;
+    } else {
+        us = (elapsed + cycles_per_us / 2) / cycles_per_us;
+    }
+    bucket = perf_bucket(us);
+
+    level = rt_hw_interrupt_disable();
+    if (st->count == 0 || us < st->min) {
+        st->min = us;
+    }
+    if (us > st->max) {
+        st->max = us;
+    }
+    st->count++;
+    st->sum += us;
+    if (st->hist[bucket] < 0xFFFF) {
+        st->hist[bucket]++;
+    }
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * 由直方图估算百分位（us，取所在桶上界）
+ */
+static rt_uint32_t perf_percentile(struct perf_stat *st, rt_uint32_t permille)
+{
+    rt_uint32_t need = (st->count * permille + 999) / 1000;  // 需要覆盖的样本数
+    rt_uint32_t seen = 0;
+    int i;
+
+    for (i = 0; i < PERF_BUCKETS; i++) {
+        seen += st->hist[i];
+        if (seen >= need) {
+            return perf_bucket_upper(i);
+        }
+    }
+    return perf_bucket_upper(PERF_BUCKETS - 1);
+}
+
+/**
+ * msh命令：输出各阶段耗时统计并清零
+ *
+ * 用法：perf [peek]，peek只输出不清零。
+ */
+static int perf_cmd(int argc, char **argv)
+{
+    struct perf_stat snapshot;
+    rt_base_t level;
+    int i;
+
+    rt_kprintf("%-16s %8s %10s %10s %10s %10s\n", "stage", "count", "min(us)", "avg(us)", "max(us)", "p99(us)");
+    for (i = 0; i < PERF_STAGE_MAX; i++) {
+        level = rt_hw_interrupt_disable();
+        snapshot = stats[i];
+        if (!(argc > 1 && rt_strcmp(argv[1], "peek") == 0)) {
+            rt_memset(&stats[i], 0, sizeof(stats[i]));
+        }
+        rt_hw_interrupt_enable(level);
+
+        if (snapshot.count == 0) {
+            continue;
+        }
+        rt_kprintf("%-16s %8d %10d %10d %10d %10d\n", stage_names[i], snapshot.count,
+                   snapshot.min,
+                   (rt_uint32_t)(snapshot.sum / snapshot.count),
+                   snapshot.max,
+                   perf_percentile(&snapshot, 990));
+    }
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(perf_cmd, perf, dump and reset per-stage timing statistics);
+
+#endif /* APP_USING_PERF */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         基于DWT周期计数器的性能剖析
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __PERF_H__
+#define __PERF_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+/* 定义后启用性能剖析；未定义时所有埋点编译为空 */
+#define APP_USING_PERF
+
+#ifdef APP_USING_PERF
+#include <board.h>  // DWT周期计数器
+#include "trace.h"  // 阶段边界同时写入事件跟踪
+#include "wall_time.h"  // 会阻塞的阶段按节拍加SysTick计数计时
+#endif
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 剖析的流水线阶段 */
+typedef enum {
+    PERF_AHT20_SEND = 0,    // AHT20发送测量命令（I2C写）
+    PERF_AHT20_CONVERT,     // AHT20等待转换完成
+    PERF_AHT20_RECV,        // AHT20读取测量结果（I2C读）
+    PERF_AP3216C_READ,      // AP3216C读取照度
+    PERF_LCD_DRAW,          // 绘制一帧（不含刷新）
+    PERF_LCD_FLUSH,         // 帧缓冲刷新到屏幕
+    PERF_URL_FORMAT,        // 构造上传URL
+    PERF_HTTP_REQUEST,      // webclient_get（建立连接+发送请求+接收响应头）
+    PERF_HTTP_READ,         // 读取响应正文
+    PERF_TLS_CONNECT,       // HTTPS：TCP连接
+    PERF_TLS_HANDSHAKE,     // HTTPS：TLS握手
+    PERF_TLS_SEND,          // HTTPS：发送请求
+    PERF_TLS_RECV,          // HTTPS：接收响应
+    PERF_STAGE_MAX
+} perf_stage_t;
+
+#ifdef APP_USING_PERF
+
+/*
+ * 计时方式：阶段中会阻塞（睡眠、等待互斥锁/信号量/网络）时空闲线程可能进入WFI/STOP，
+ * DWT周期计数器随内核时钟停止，这些阶段改用wall_time_us()计时；
+ * 只有从不阻塞的阶段使用精度更高的DWT周期计数。
+ */
+#define PERF_WALL_STAGES    ((1UL << PERF_AHT20_SEND) | (1UL << PERF_AHT20_CONVERT) | \
+                             (1UL << PERF_AHT20_RECV) | (1UL << PERF_AP3216C_READ) | \
+                             (1UL << PERF_LCD_DRAW) | (1UL << PERF_LCD_FLUSH) | \
+                             (1UL << PERF_HTTP_REQUEST) | (1UL << PERF_HTTP_READ) | \
+                             (1UL << PERF_TLS_CONNECT) | (1UL << PERF_TLS_HANDSHAKE) | \
+                             (1UL << PERF_TLS_SEND) | (1UL << PERF_TLS_RECV))
+#define PERF_STAGE_WALL(stage)  ((PERF_WALL_STAGES >> (stage)) & 1)
+#define PERF_NOW(stage)     (PERF_STAGE_WALL(stage) ? wall_time_us() : DWT->CYCCNT)
+
+/**
+ * 启用DWT周期计数器
+ */
+void perf_init(void);
+
+/**
+ * 记录一次阶段耗时
+ *
+ * @param stage   阶段
+ * @param elapsed 耗时，PERF_STAGE_WALL的阶段为微秒，其余为CPU周期
+ */
+void perf_record(perf_stage_t stage, rt_uint32_t elapsed);
+
+/**
+ * 获取阶段名称
+ *
+ * @param stage 阶段
+ * @return 阶段名称
+ */
+const char *perf_stage_name(perf_stage_t stage);
+
+/*
+ * 成对使用：PERF_BEGIN在当前作用域定义起始时刻，PERF_END记录耗时并结束跟踪阶段。
+ * 出错提前返回或goto的路径上也要先PERF_END，否则事件跟踪中该阶段没有结束事件。
+ */
+#define PERF_BEGIN(stage)   TRACE_STAGE(stage, RT_TRUE); rt_uint32_t perf_t0_##stage = PERF_NOW(stage)
+#define PERF_END(stage)     do { perf_record(stage, PERF_NOW(stage) - perf_t0_##stage); \
+                                 TRACE_STAGE(stage, RT_FALSE); } while (0)
+
+#else
+
+#define perf_init()
+#define PERF_BEGIN(stage)
+#define PERF_END(stage)
+
+#endif /* APP_USING_PERF */
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         线程栈水位检测
+ */
+
+#include "stack_wm.h"      // 栈水位检测头文件
+
+#define STACK_WM_MARGIN     25      // 推荐栈大小在最大使用量基础上的余量（百分比）
+#define STACK_WM_ALIGN      128     // 推荐栈大小的对齐粒度
+#define STACK_WM_WARN       85      // 使用率超过该值时告警（百分比）
+
+/**
+ * 获取线程栈的历史最大使用量
+ *
+ * @param thread 线程句柄
+ * @return 最大使用字节数
+ */
+rt_size_t stack_wm_used(rt_thread_t thread)
+{
+    rt_uint8_t *ptr;
+    rt_uint8_t *end = (rt_uint8_t *)thread->stack_addr + thread->stack_size;
+
+#ifdef ARCH_CPU_STACK_GROWS_UPWARD
+    for (ptr = end - 1; ptr >= (rt_uint8_t *)thread->stack_addr && *ptr == '#'; ptr--);
+    return ptr + 1 - (rt_uint8_t *)thread->stack_addr;
+#else
+    for (ptr = (rt_uint8_t *)thread->stack_addr; ptr < end && *ptr == '#'; ptr++);
+    return end - ptr;
+#endif
+}
+
+#ifdef RT_USING_OVERFLOW_CHECK
+#define STACK_WM_MAX_THREADS 32     // 一次最多列出的线程数
+
+/**
+ * msh命令：列出各线程栈的最大使用量和推荐大小
+ *
+ * 输出格式与tools/stack_report.py的--runtime输入一致，
+ * 长时间运行（覆盖重连、HTTPS握手等路径）后再采集结果才有意义。
+ */
+static int stack_wm(int argc, char **argv)
+{
+    struct {
+        char name[RT_NAME_MAX + 1];
+        rt_size_t size;
+        rt_size_t used;
+    } items[STACK_WM_MAX_THREADS];
+    struct rt_object_information *info = rt_object_get_information(RT_Object_Class_Thread);
+    struct rt_list_node *node;
+    rt_thread_t thread;
+    rt_size_t recommend;
+    int count = 0, i;
+
+    /* 锁调度器时只复制数据，输出在解锁后进行 */
+    rt_enter_critical();
+    for (node = info->object_list.next; node != &info->object_list && count < STACK_WM_MAX_THREADS; node = node->next) {
+        thread = (rt_thread_t)rt_list_entry(node, struct rt_object, list);
+        rt_strncpy(items[count].name, thread->name, RT_NAME_MAX);
+        items[count].name[RT_NAME_MAX] = '\0';
+        items[count].size = thread->stack_size;
+        items[count].used = stack_wm_used(thread);
+        count++;
+    }
+    rt_exit_critical();
+
+    rt_kprintf("%-8s %6s %6s %4s %9s\n", "thread", "size", "used", "pct", "recommend");
+    for (i = 0; i < count; i++) {
+        recommend = RT_ALIGN(items[i].used * (100 + STACK_WM_MARGIN) / 100, STACK_WM_ALIGN);
+        rt_kprintf("%-8s %6d %6d %3d%% %9d%s\n", items[i].name, items[i].size, items[i].used,
+                   items[i].used * 100 / items[i].size, recommend,
+                   items[i].used * 100 / items[i].size > STACK_WM_WARN ? "  !" : "");
+    }
+
+    return 0;
+}
+MSH_CMD_EXPORT(stack_wm, show per-thread stack high-water marks);
+#endif /* RT_USING_OVERFLOW_CHECK */
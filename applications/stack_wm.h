@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         线程栈水位检测
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __STACK_WM_H__
+#define __STACK_WM_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 获取线程栈的历史最大使用量
+ *
+ * 线程创建时栈被填充为'#'（RT_USING_OVERFLOW_CHECK），
+ * 从栈底向栈顶扫描仍为'#'的字节即可得到从未被使用过的部分。
+ *
+ * @param thread 线程句柄
+ * @return 最大使用字节数
+ */
+rt_size_t stack_wm_used(rt_thread_t thread);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
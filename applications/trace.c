@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         RTT二进制事件跟踪
+ */
+
+#include "trace.h"         // 事件跟踪头文件
+#include "perf.h"          // 流水线阶段名称
+#include "wall_time.h"     // 事件时间戳
+#include <board.h>         // IPSR
+
+#ifdef APP_USING_TRACE
+
+#define TRACE_BUF_SIZE      4096    // RTT上行缓冲区大小
+#define TRACE_MAX_THREADS   32      // 最多登记的线程数
+#define TRACE_MAX_MUTEXES   16      // 最多登记的互斥锁数
+#define TRACE_NAME_LEN      16      // 名称定义事件中名称的长度
+
+/*
+ * SEGGER RTT控制块（布局与SEGGER_RTT.c一致），调试器在RAM中搜索"SEGGER RTT"
+ * 或按符号_SEGGER_RTT找到它，再直接读取上行缓冲区，目标端无需等待。
+ * 通道0用于跟踪数据，缓冲区满时丢弃新事件（非阻塞）。
+ */
+struct rtt_buffer {
+    const char *name;               // 通道名
+    char *buffer;                   // 缓冲区
+    unsigned size;                  // 缓冲区大小
+    volatile unsigned wr_off;       // 写位置（目标端更新）
+    volatile unsigned rd_off;       // 读位置（调试器更新）
+    unsigned flags;                 // 模式，0为满时丢弃
+};
+
+struct rtt_control_block {
+    char id[16];                    // "SEGGER RTT"
+    int max_up;                     // 上行通道数
+    int max_down;                   // 下行通道数
+    struct rtt_buffer up[1];
+    struct rtt_buffer down[1];
+};
+
+struct rtt_control_block _SEGGER_RTT;
+static char trace_up_buf[TRACE_BUF_SIZE];
+static char trace_down_buf[16];
+
+static volatile rt_bool_t trace_enabled = RT_FALSE;
+static rt_uint32_t trace_events = 0;        // 写入的事件数
+static rt_uint32_t trace_dropped = 0;       // 待报告的丢失事件数
+static rt_uint32_t trace_dropped_total = 0; // 累计丢失事件数
+
+/* 线程和互斥锁登记表，首次出现时输出名称定义事件，之后只用编号 */
+static rt_thread_t threads[TRACE_MAX_THREADS];
+static rt_object_t mutexes[TRACE_MAX_MUTEXES];
+
+/**
+ * 向RTT上行缓冲区写入数据（调用时须已关中断），空间不足返回RT_FALSE
+ */
+static rt_bool_t trace_put(const rt_uint8_t *data, rt_uint32_t len)
+{
+    struct rtt_buffer *up = &_SEGGER_RTT.up[0];
+    rt_uint32_t wr = up->wr_off;
+    rt_uint32_t rd = up->rd_off;
+    rt_uint32_t avail = (rd > wr) ? rd - wr - 1 : up->size - wr + rd - 1;
+    rt_uint32_t first;
+
+    if (avail < len) {
+        return RT_FALSE;
+    }
+
+    first = up->size - wr;
+    if (first > len) {
+        first = len;
+    }
+    rt_memcpy(up->buffer + wr, data, first);
+    rt_memcpy(up->buffer, data + first, len - first);
+
+    /* 数据写完后再更新写位置，调试器不会读到未完成的事件 */
+    __DMB();
+    up->wr_off = (wr + len) % up->size;
+    return RT_TRUE;
+}
+
+/**
+ * 写入一个8字节事件（调用时须已关中断）
+ */
+static void trace_emit_locked(rt_uint8_t type, rt_uint8_t id, rt_uint16_t aux)
+{
+    rt_uint8_t evt[8];
+    rt_uint32_t now = wall_time_us();
+
+    /* 先补报之前丢失的事件个数 */
+    if (trace_dropped) {
+        evt[0] = TRACE_EVT_OVERFLOW;
+        evt[1] = 0;
+        evt[2] = trace_dropped;
+        evt[3] = trace_dropped >> 8;
+        rt_memcpy(&evt[4], &now, 4);
+        if (!trace_put(evt, sizeof(evt))) {
+            trace_dropped++;
+            trace_dropped_total++;
+            return;
+        }
+        trace_dropped = 0;
+    }
+
+    evt[0] = type;
+    evt[1] = id;
+    evt[2] = aux;
+    evt[3] = aux >> 8;
+    rt_memcpy(&evt[4], &now, 4);
+    if (trace_put(evt, sizeof(evt))) {
+        trace_events++;
+    } else {
+        trace_dropped++;
+        trace_dropped_total++;
+    }
+}
+
+/**
+ * 写入名称定义事件（调用时须已关中断）
+ */
+static void trace_name_locked(rt_uint8_t kind, rt_uint8_t id, const char *name)
+{
+    rt_uint8_t evt[8 + TRACE_NAME_LEN] = {0};
+    rt_uint32_t now = wall_time_us();
+
+    evt[0] = TRACE_EVT_NAME;
+    evt[1] = id;
+    evt[2] = kind;
+    rt_memcpy(&evt[4], &now, 4);
+    rt_strncpy((char *)&evt[8], name, TRACE_NAME_LEN);
+    if (trace_put(evt, sizeof(evt))) {
+        trace_events++;
+    } else {
+        trace_dropped++;
+        trace_dropped_total++;
+    }
+}
+
+/**
+ * 查找或登记线程编号（调用时须已关中断）
+ */
+static rt_uint8_t trace_thread_id(rt_thread_t thread)
+{
+    int i;
+
+    for (i = 0; i < TRACE_MAX_THREADS && threads[i] != RT_NULL; i++) {
+        if (threads[i] == thread) {
+            return i;
+        }
+    }
+    if (i == TRACE_MAX_THREADS) {
+        return 0xFF;
+    }
+
+    threads[i] = thread;
+    trace_name_locked(TRACE_NAME_THREAD, i, thread->name);
+    return i;
+}
+
+/**
+ * 查找或登记互斥锁编号（调用时须已关中断）
+ */
+static rt_uint8_t trace_mutex_id(rt_object_t object)
+{
+    int i;
+
+    for (i = 0; i < TRACE_MAX_MUTEXES && mutexes[i] != RT_NULL; i++) {
+        if (mutexes[i] == object) {
+            return i;
+        }
+    }
+    if (i == TRACE_MAX_MUTEXES) {
+        return 0xFF;
+    }
+
+    mutexes[i] = object;
+    trace_name_locked(TRACE_NAME_MUTEX, i, object->name);
+    return i;
+}
+
+/**
+ * 记录线程切换（由cpu_mon的调度器钩子转发，调用时已关中断）
+ */
+void trace_switch(rt_thread_t from, rt_thread_t to)
+{
+    rt_uint8_t from_id;
+
+    if (!trace_enabled) {
+        return;
+    }
+    from_id = trace_thread_id(from);
+    trace_emit_locked(TRACE_EVT_SWITCH, trace_thread_id(to), from_id);
+}
+
+/**
+ * 记录流水线阶段开始/结束（由PERF_BEGIN/PERF_END调用）
+ */
+void trace_stage(rt_uint8_t stage, rt_bool_t begin)
+{
+    rt_base_t level;
+
+    if (!trace_enabled) {
+        return;
+    }
+    level = rt_hw_interrupt_disable();
+    trace_emit_locked(begin ? TRACE_EVT_STAGE_BEGIN : TRACE_EVT_STAGE_END, stage, 0);
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * 中断进入/退出钩子，附加值为IRQ号（SysTick为-1）
+ */
+static void trace_isr_enter(void)
+{
+    rt_base_t level;
+
+    if (!trace_enabled) {
+        return;
+    }
+    level = rt_hw_interrupt_disable();
+    trace_emit_locked(TRACE_EVT_ISR_ENTER, 0, (rt_uint16_t)((rt_int32_t)__get_IPSR() - 16));
+    rt_hw_interrupt_enable(level);
+}
+
+static void trace_isr_leave(void)
+{
+    rt_base_t level;
+
+    if (!trace_enabled) {
+        return;
+    }
+    level = rt_hw_interrupt_disable();
+    trace_emit_locked(TRACE_EVT_ISR_EXIT, 0, (rt_uint16_t)((rt_int32_t)__get_IPSR() - 16));
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * 内核对象钩子：只记录互斥锁
+ */
+static void trace_object(rt_object_t object, rt_uint8_t type)
+{
+    rt_base_t level;
+
+    if (!trace_enabled || rt_object_get_type(object) != RT_Object_Class_Mutex) {
+        return;
+    }
+    level = rt_hw_interrupt_disable();
+    trace_emit_locked(type, trace_mutex_id(object), 0);
+    rt_hw_interrupt_enable(level);
+}
+
+static void trace_object_trytake(rt_object_t object)
+{
+    trace_object(object, TRACE_EVT_MUTEX_WAIT);
+}
+
+static void trace_object_take(rt_object_t object)
+{
+    trace_object(object, TRACE_EVT_MUTEX_TAKE);
+}
+
+static void trace_object_put(rt_object_t object)
+{
+    trace_object(object, TRACE_EVT_MUTEX_RELEASE);
+}
+
+/**
+ * 初始化RTT控制块并安装中断/内核对象钩子
+ *
+ * @return 成功返回RT_EOK
+ */
+rt_err_t trace_init(void)
+{
+    _SEGGER_RTT.max_up = 1;
+    _SEGGER_RTT.max_down = 1;
+    _SEGGER_RTT.up[0].name = "Trace";
+    _SEGGER_RTT.up[0].buffer = trace_up_buf;
+    _SEGGER_RTT.up[0].size = sizeof(trace_up_buf);
+    _SEGGER_RTT.down[0].name = "Unused";
+    _SEGGER_RTT.down[0].buffer = trace_down_buf;
+    _SEGGER_RTT.down[0].size = sizeof(trace_down_buf);
+
+    /* 标识最后写入，且分两段拷贝，避免调试器先找到未初始化完的控制块或Flash中的字符串 */
+    rt_strncpy(&_SEGGER_RTT.id[7], "RTT", 9);
+    __DMB();
+    rt_memcpy(&_SEGGER_RTT.id[0], "SEGGER ", 7);
+
+    rt_interrupt_enter_sethook(trace_isr_enter);
+    rt_interrupt_leave_sethook(trace_isr_leave);
+    rt_object_trytake_sethook(trace_object_trytake);
+    rt_object_take_sethook(trace_object_take);
+    rt_object_put_sethook(trace_object_put);
+
+    return RT_EOK;
+}
+
+/**
+ * msh命令：开始/停止跟踪
+ *
+ * 用法：trace [start|stop]
+ * 开始时清空登记表并重新输出阶段名称，抓取的数据用tools/trace2json.py转换为
+ * Chrome trace/Perfetto可打开的JSON。
+ */
+static int trace(int argc, char **argv)
+{
+    struct rtt_buffer *up = &_SEGGER_RTT.up[0];
+    rt_base_t level;
+    int i;
+
+    if (argc > 1 && rt_strcmp(argv[1], "start") == 0) {
+        level = rt_hw_interrupt_disable();
+        rt_memset(threads, 0, sizeof(threads));
+        rt_memset(mutexes, 0, sizeof(mutexes));
+        trace_events = 0;
+        trace_dropped = 0;
+        trace_dropped_total = 0;
+#ifdef APP_USING_PERF
+        for (i = 0; i < PERF_STAGE_MAX; i++) {
+            trace_name_locked(TRACE_NAME_STAGE, i, perf_stage_name((perf_stage_t)i));
+        }
+#endif
+        trace_enabled = RT_TRUE;
+        rt_hw_interrupt_enable(level);
+    } else if (argc > 1 && rt_strcmp(argv[1], "stop") == 0) {
+        trace_enabled = RT_FALSE;
+    }
+
+    rt_kprintf("trace: %s, events: %d, dropped: %d, buffer: %d/%d\n",
+               trace_enabled ? "on" : "off", trace_events, trace_dropped_total,
+               (up->wr_off + up->size - up->rd_off) % up->size, up->size);
+    return 0;
+}
+MSH_CMD_EXPORT(trace, RTT event trace: trace [start|stop]);
+
+#endif /* APP_USING_TRACE */
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         RTT二进制事件跟踪
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+/* 定义后启用事件跟踪；未定义时所有跟踪点编译为空 */
+#define APP_USING_TRACE
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * 事件类型（每个事件8字节：类型、编号、附加值、时间戳）
+ * 时间戳为记录时的微秒数（wall_time_us），与clock_scale档位无关，
+ * 主机端不需要知道主频，WFI/STOP期间也不会把时间线压缩。
+ */
+typedef enum {
+    TRACE_EVT_NAME = 1,         // 名称定义（后跟16字节名称）
+    TRACE_EVT_SWITCH,           // 线程切换：编号为切入线程，附加值为切出线程
+    TRACE_EVT_ISR_ENTER,        // 进入中断：附加值为IRQ号
+    TRACE_EVT_ISR_EXIT,         // 退出中断
+    TRACE_EVT_STAGE_BEGIN,      // 流水线阶段开始（阶段见perf.h）
+    TRACE_EVT_STAGE_END,        // 流水线阶段结束
+    TRACE_EVT_MUTEX_WAIT,       // 开始获取互斥锁
+    TRACE_EVT_MUTEX_TAKE,       // 获得互斥锁
+    TRACE_EVT_MUTEX_RELEASE,    // 释放互斥锁
+    TRACE_EVT_OVERFLOW          // 缓冲区满丢失事件：附加值为丢失个数
+} trace_evt_t;
+
+/* 名称定义事件的名称类别 */
+#define TRACE_NAME_THREAD   0
+#define TRACE_NAME_MUTEX    1
+#define TRACE_NAME_STAGE    2
+
+#ifdef APP_USING_TRACE
+
+/**
+ * 初始化RTT控制块并安装中断/内核对象钩子（跟踪默认关闭，用msh命令trace start开始）
+ *
+ * @return 成功返回RT_EOK
+ */
+rt_err_t trace_init(void);
+
+/**
+ * 记录线程切换（由cpu_mon的调度器钩子转发）
+ */
+void trace_switch(rt_thread_t from, rt_thread_t to);
+
+/**
+ * 记录流水线阶段开始/结束（由PERF_BEGIN/PERF_END调用）
+ *
+ * @param stage 阶段编号
+ * @param begin RT_TRUE为开始
+ */
+void trace_stage(rt_uint8_t stage, rt_bool_t begin);
+
+#define TRACE_SWITCH(from, to)      trace_switch(from, to)
+#define TRACE_STAGE(stage, begin)   trace_stage(stage, begin)
+
+#else
+
+#define trace_init()                (RT_EOK)
+#define TRACE_SWITCH(from, to)
+#define TRACE_STAGE(stage, begin)
+
+#endif /* APP_USING_TRACE */
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
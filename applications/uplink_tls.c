@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         HTTPS上传（会话复用+静态内存池）
+ */
+
+#include "uplink_tls.h"    // HTTPS上传头文件
+#include <rtdevice.h>      // RT设备驱动框架
+#include "clock_scale.h"   // 握手期间满速
+#include "perf.h"          // 性能剖析
+
+#ifdef PKG_USING_MBEDTLS
+
+#include <string.h>
+#include <stdlib.h>
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include <mbedtls/config.h>
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/platform.h>
+#include <mbedtls/memory_buffer_alloc.h>
+
+#if !defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C) || !defined(MBEDTLS_PLATFORM_MEMORY)
+#error "uplink_tls requires MBEDTLS_MEMORY_BUFFER_ALLOC_C and MBEDTLS_PLATFORM_MEMORY (menuconfig: PhytoLink Application)"
+#endif
+
+/*
+ * mbedTLS静态内存池大小，按一次完整握手（ECDHE-RSA，单张2048位自签名证书）的峰值估算：
+ *   收发记录缓冲区      2 x 3.9KB（MBEDTLS_SSL_MAX_CONTENT_LEN=3584加报文开销）
+ *   握手参数+两套密钥   约3.5KB
+ *   对端证书链          约2.5KB（会话保存证书，复用期间一直占用）
+ *   ECDHE/RSA大数运算   约4KB（MBEDTLS_ECP_WINDOW_SIZE=2）
+ *   分配块头            约150块 x 32字节
+ * 合计约23KB，留20%余量。tls_bench和每次完整握手后的日志会打印实测峰值，
+ * 峰值超过内存池的7/8时报警，更换服务器证书或密码套件后应据此重新调整。
+ */
+#define UPLINK_TLS_ARENA_SIZE    (28 * 1024)
+#define UPLINK_TLS_TIMEOUT       5000          // 读超时(ms)
+#define UPLINK_TLS_REQ_SIZE      320           // 请求头缓冲区大小
+#define UPLINK_TLS_HDR_SIZE      512           // 响应头缓冲区大小
+
+/* TLS全局上下文：配置和随机数发生器只初始化一次，跨连接共享 */
+struct uplink_tls {
+    mbedtls_ssl_config conf;            // TLS配置
+    mbedtls_entropy_context entropy;    // 熵源
+    mbedtls_ctr_drbg_context ctr_drbg;  // 随机数发生器
+    mbedtls_ssl_session session;        // 缓存的会话（用于复用）
+    rt_bool_t session_valid;            // 缓存会话是否可用
+    rt_bool_t inited;                   // 是否已初始化
+};
+
+static struct uplink_tls uplink;                 // 全局上下文
+static struct rt_mutex uplink_lock;              // 上传线程与msh基准测试互斥
+
+/* mbedTLS所有动态分配都落在该静态内存池中，不再占用系统堆 */
+static unsigned char uplink_tls_arena[UPLINK_TLS_ARENA_SIZE];
+
+/* 握手统计 */
+static rt_uint32_t full_handshakes = 0;          // 完整握手次数
+static rt_uint32_t resumed_handshakes = 0;       // 会话复用握手次数
+static rt_uint32_t last_handshake_ms = 0;        // 最近一次握手耗时
+static rt_size_t arena_peak = 0;                 // 内存池实测峰值（字节）
+
+/**
+ * 初始化互斥锁（只执行一次，与TLS上下文的初始化结果无关）
+ */
+static void uplink_tls_lock_init(void)
+{
+    static rt_bool_t lock_inited = RT_FALSE;
+
+    rt_enter_critical();
+    if (!lock_inited) {
+        rt_mutex_init(&uplink_lock, "uplink", RT_IPC_FLAG_PRIO);
+        lock_inited = RT_TRUE;
+    }
+    rt_exit_critical();
+}
+
+/**
+ * 初始化HTTPS上传通道（静态内存池、随机数发生器、TLS配置）
+ *
+ * 失败时释放已初始化的上下文，下次调用会重新初始化。
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t uplink_tls_init(void)
+{
+    const char *pers = "phytolink";  // 随机数个性化字符串
+
+    uplink_tls_lock_init();
+    rt_mutex_take(&uplink_lock, RT_WAITING_FOREVER);
+    if (uplink.inited) {
+        rt_mutex_release(&uplink_lock);
+        return RT_EOK;
+    }
+
+    mbedtls_memory_buffer_alloc_init(uplink_tls_arena, sizeof(uplink_tls_arena));
+
+    mbedtls_ssl_config_init(&uplink.conf);
+    mbedtls_entropy_init(&uplink.entropy);
+    mbedtls_ctr_drbg_init(&uplink.ctr_drbg);
+    mbedtls_ssl_session_init(&uplink.session);
+
+    if (mbedtls_ctr_drbg_seed(&uplink.ctr_drbg, mbedtls_entropy_func, &uplink.entropy,
+                              (const unsigned char *)pers, strlen(pers)) != 0) {
+        goto __fail;
+    }
+
+    if (mbedtls_ssl_config_defaults(&uplink.conf, MBEDTLS_SSL_IS_CLIENT,
+                                    MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT) != 0) {
+        goto __fail;
+    }
+
+    /* 局域网内的上传服务器通常使用自签名证书，校验失败只记录不中断 */
+    mbedtls_ssl_conf_authmode(&uplink.conf, MBEDTLS_SSL_VERIFY_OPTIONAL);
+    mbedtls_ssl_conf_rng(&uplink.conf, mbedtls_ctr_drbg_random, &uplink.ctr_drbg);
+    mbedtls_ssl_conf_read_timeout(&uplink.conf, UPLINK_TLS_TIMEOUT);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&uplink.conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+    uplink.inited = RT_TRUE;
+    rt_mutex_release(&uplink_lock);
+    return RT_EOK;
+
+__fail:
+    mbedtls_ssl_session_free(&uplink.session);
+    mbedtls_ctr_drbg_free(&uplink.ctr_drbg);
+    mbedtls_entropy_free(&uplink.entropy);
+    mbedtls_ssl_config_free(&uplink.conf);
+    mbedtls_memory_buffer_alloc_free();
+    rt_mutex_release(&uplink_lock);
+    rt_kprintf("[TLS] Init failed\n");
+    return -RT_ERROR;
+}
+
+/**
+ * 记录内存池实测峰值，出现新峰值时打印，接近上限时报警
+ *
+ * 峰值统计需要MBEDTLS_MEMORY_DEBUG，未打开时不做任何事。
+ */
+static void uplink_tls_check_arena(void)
+{
+#if defined(MBEDTLS_MEMORY_DEBUG)
+    size_t max_used, max_blocks;
+
+    mbedtls_memory_buffer_alloc_max_get(&max_used, &max_blocks);
+    if (max_used <= arena_peak) {
+        return;
+    }
+    arena_peak = max_used;
+    if (max_used > UPLINK_TLS_ARENA_SIZE / 8 * 7) {
+        rt_kprintf("[TLS] Arena peak %d / %d bytes (%d blocks), raise UPLINK_TLS_ARENA_SIZE\n",
+                   max_used, UPLINK_TLS_ARENA_SIZE, max_blocks);
+    } else {
+        rt_kprintf("[TLS] Arena peak %d / %d bytes (%d blocks)\n", max_used, UPLINK_TLS_ARENA_SIZE, max_blocks);
+    }
+#endif
+}
+
+/**
+ * 丢弃缓存的TLS会话，下次请求做完整握手
+ */
+void uplink_tls_session_reset(void)
+{
+    uplink_tls_lock_init();
+    rt_mutex_take(&uplink_lock, RT_WAITING_FOREVER);
+    if (uplink.inited) {
+        mbedtls_ssl_session_free(&uplink.session);
+        mbedtls_ssl_session_init(&uplink.session);
+        uplink.session_valid = RT_FALSE;
+    }
+    rt_mutex_release(&uplink_lock);
+}
+
+/**
+ * 读取HTTP响应，解析状态码并拷贝正文
+ *
+ * @return 成功返回HTTP状态码，失败返回负的错误码
+ */
+static int uplink_tls_read_response(mbedtls_ssl_context *ssl, char *resp, rt_size_t resp_size)
+{
+    char header[UPLINK_TLS_HDR_SIZE];   // 响应头缓冲区
+    rt_size_t len = 0;                  // 已读取长度
+    char *body;                         // 正文起始位置
+    int status = -1;                    // HTTP状态码
+    int ret;
+
+    /* 服务器以Connection: close结束响应，读到关闭或缓冲区满为止 */
+    while (len < sizeof(header) - 1) {
+        ret = mbedtls_ssl_read(ssl, (unsigned char *)header + len, sizeof(header) - 1 - len);
+        if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+            continue;
+        }
+        if (ret <= 0) {
+            break;
+        }
+        len += ret;
+    }
+    header[len] = '\0';
+
+    if (len < 12 || strncmp(header, "HTTP/1.", 7) != 0) {
+        return -RT_ERROR;
+    }
+    status = atoi(header + 9);
+
+    if (resp != RT_NULL && resp_size > 0) {
+        body = strstr(header, "\r\n\r\n");
+        body = body ? body + 4 : header + len;
+        rt_strncpy(resp, body, resp_size - 1);
+        resp[resp_size - 1] = '\0';
+    }
+
+    return status;
+}
+
+/**
+ * 通过HTTPS发送一次GET请求
+ *
+ * @param host      服务器地址
+ * @param port      服务器端口
+ * @param path      请求路径（含查询参数）
+ * @param resp      响应正文缓冲区，可为RT_NULL
+ * @param resp_size 响应正文缓冲区大小
+ * @return 成功返回HTTP状态码，失败返回负的错误码
+ */
+int uplink_tls_get(const char *host, int port, const char *path, char *resp, rt_size_t resp_size)
+{
+    mbedtls_ssl_context ssl;            // 本次连接的TLS上下文
+    mbedtls_net_context net;            // 本次连接的套接字
+    char port_str[8];                   // 端口字符串
+    char request[UPLINK_TLS_REQ_SIZE];  // 请求头
+    rt_tick_t start;                    // 握手起始时刻
+    int req_len, written, ret;
+
+    RT_ASSERT(host != RT_NULL);
+    RT_ASSERT(path != RT_NULL);
+
+    if (!uplink.inited && uplink_tls_init() != RT_EOK) {
+        return -RT_ERROR;
+    }
+
+    rt_mutex_take(&uplink_lock, RT_WAITING_FOREVER);
+
+    mbedtls_net_init(&net);
+    mbedtls_ssl_init(&ssl);
+
+    rt_snprintf(port_str, sizeof(port_str), "%d", port);
+    PERF_BEGIN(PERF_TLS_CONNECT);
+    ret = mbedtls_net_connect(&net, host, port_str, MBEDTLS_NET_PROTO_TCP);
+    PERF_END(PERF_TLS_CONNECT);
+    if (ret != 0) {
+        ret = -RT_ERROR;
+        goto __exit;
+    }
+
+    if (mbedtls_ssl_setup(&ssl, &uplink.conf) != 0
+            || mbedtls_ssl_set_hostname(&ssl, host) != 0) {
+        rt_kprintf("[TLS] Arena exhausted (%d bytes) setting up connection\n", UPLINK_TLS_ARENA_SIZE);
+        ret = -RT_ENOMEM;
+        goto __exit;
+    }
+    mbedtls_ssl_set_bio(&ssl, &net, mbedtls_net_send, mbedtls_net_recv, mbedtls_net_recv_timeout);
+
+    /* 带上上次的会话，服务器接受时只需一次简短握手 */
+    if (uplink.session_valid) {
+        mbedtls_ssl_set_session(&ssl, &uplink.session);
+    }
+
+    /* 握手的ECDHE/签名验证是计算密集的，满速执行 */
+    start = rt_tick_get();
+    clock_scale_request(CLOCK_LEVEL_HIGH);
+    PERF_BEGIN(PERF_TLS_HANDSHAKE);
+    while ((ret = mbedtls_ssl_handshake(&ssl)) != 0) {
+        if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+            PERF_END(PERF_TLS_HANDSHAKE);
+            clock_scale_release(CLOCK_LEVEL_HIGH);
+            if (ret == MBEDTLS_ERR_SSL_ALLOC_FAILED) {
+                rt_kprintf("[TLS] Arena exhausted (%d bytes) during handshake\n", UPLINK_TLS_ARENA_SIZE);
+            } else {
+                rt_kprintf("[TLS] Handshake failed: -0x%04x\n", -ret);
+            }
+            uplink.session_valid = RT_FALSE;
+            ret = -RT_ERROR;
+            goto __exit;
+        }
+    }
+    PERF_END(PERF_TLS_HANDSHAKE);
+    clock_scale_release(CLOCK_LEVEL_HIGH);
+    uplink_tls_check_arena();
+    last_handshake_ms = (rt_tick_get() - start) * 1000 / RT_TICK_PER_SECOND;
+
+    /* 会话ID与缓存一致说明服务器接受了复用 */
+    if (uplink.session_valid && ssl.session != RT_NULL
+            && ssl.session->id_len == uplink.session.id_len && ssl.session->id_len > 0
+            && rt_memcmp(ssl.session->id, uplink.session.id, ssl.session->id_len) == 0) {
+        resumed_handshakes++;
+    } else {
+        full_handshakes++;
+        if (mbedtls_ssl_get_verify_result(&ssl) != 0) {
+            rt_kprintf("[TLS] Server certificate not verified\n");
+        }
+
+        /* 保存新会话供下次复用 */
+        mbedtls_ssl_session_free(&uplink.session);
+        mbedtls_ssl_session_init(&uplink.session);
+        uplink.session_valid = (mbedtls_ssl_get_session(&ssl, &uplink.session) == 0);
+    }
+
+    req_len = rt_snprintf(request, sizeof(request),
+                          "GET %s HTTP/1.1\r\nHost: %s:%d\r\nConnection: close\r\n\r\n",
+                          path, host, port);
+    PERF_BEGIN(PERF_TLS_SEND);
+    for (written = 0; written < req_len; written += ret) {
+        ret = mbedtls_ssl_write(&ssl, (const unsigned char *)request + written, req_len - written);
+        if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+            ret = 0;
+            continue;
+        }
+        if (ret < 0) {
+            PERF_END(PERF_TLS_SEND);
+            ret = -RT_EIO;
+            goto __exit;
+        }
+    }
+
+    PERF_END(PERF_TLS_SEND);
+
+    PERF_BEGIN(PERF_TLS_RECV);
+    ret = uplink_tls_read_response(&ssl, resp, resp_size);
+    PERF_END(PERF_TLS_RECV);
+    mbedtls_ssl_close_notify(&ssl);
+
+__exit:
+    mbedtls_ssl_free(&ssl);
+    mbedtls_net_free(&net);
+    rt_mutex_release(&uplink_lock);
+
+    return ret;
+}
+
+/**
+ * msh命令：HTTPS握手基准测试
+ *
+ * 用法：tls_bench <host> <port> [次数]
+ * 先做N次不复用会话的完整握手，再做N次会话复用握手，比较耗时与内存峰值。
+ * 主机侧可用 "openssl s_server -accept 8443 -cert cert.pem -key key.pem -www" 作为服务器。
+ */
+static int tls_bench(int argc, char **argv)
+{
+    int rounds = 5;                     // 每种模式的请求次数
+    int port, i, pass;
+    rt_uint32_t total_ms;
+    rt_tick_t start;
+
+    if (argc < 3) {
+        rt_kprintf("usage: tls_bench <host> <port> [rounds]\n");
+        return -1;
+    }
+    port = atoi(argv[2]);
+    if (argc > 3) {
+        rounds = atoi(argv[3]);
+    }
+    if (rounds <= 0) {
+        rounds = 1;
+    }
+
+    if (uplink_tls_init() != RT_EOK) {
+        rt_kprintf("TLS init failed\n");
+        return -1;
+    }
+
+    for (pass = 0; pass < 2; pass++) {
+        rt_uint32_t full_before = full_handshakes, resumed_before = resumed_handshakes;
+        rt_uint32_t hs_total = 0;
+
+        total_ms = 0;
+        uplink_tls_session_reset();
+#if defined(MBEDTLS_MEMORY_DEBUG)
+        mbedtls_memory_buffer_alloc_max_reset();
+#endif
+        for (i = 0; i < rounds; i++) {
+            if (pass == 0) {
+                uplink_tls_session_reset();  // 第一轮：每次都做完整握手
+            }
+            start = rt_tick_get();
+            if (uplink_tls_get(argv[1], port, "/", RT_NULL, 0) < 0) {
+                rt_kprintf("request %d failed\n", i);
+                continue;
+            }
+            total_ms += (rt_tick_get() - start) * 1000 / RT_TICK_PER_SECOND;
+            hs_total += last_handshake_ms;
+        }
+
+        rt_kprintf("%s: full %d, resumed %d, avg handshake %d ms, avg request %d ms\n",
+                   pass == 0 ? "no resumption  " : "with resumption",
+                   full_handshakes - full_before, resumed_handshakes - resumed_before,
+                   hs_total / rounds, total_ms / rounds);
+#if defined(MBEDTLS_MEMORY_DEBUG)
+        {
+            size_t max_used, max_blocks;
+
+            mbedtls_memory_buffer_alloc_max_get(&max_used, &max_blocks);
+            rt_kprintf("  peak arena use: %d / %d bytes (%d blocks)\n",
+                       max_used, UPLINK_TLS_ARENA_SIZE, max_blocks);
+        }
+#endif
+    }
+
+#if !defined(MBEDTLS_MEMORY_DEBUG)
+    rt_kprintf("peak memory: enable MBEDTLS_MEMORY_DEBUG (menuconfig: PhytoLink Application)\n");
+#endif
+
+    return 0;
+}
+MSH_CMD_EXPORT(tls_bench, benchmark HTTPS handshake with and without session resumption);
+
+#endif /* PKG_USING_MBEDTLS */
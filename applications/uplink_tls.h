@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         HTTPS上传（会话复用+静态内存池）
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __UPLINK_TLS_H__
+#define __UPLINK_TLS_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 初始化HTTPS上传通道（静态内存池、随机数发生器、TLS配置）
+ *
+ * mbedTLS的全部动态分配都来自UPLINK_TLS_ARENA_SIZE大小的静态内存池，
+ * 需要打开MBEDTLS_MEMORY_BUFFER_ALLOC_C（否则编译报错）。失败后可再次调用。
+ *
+ * @return 成功返回RT_EOK，失败返回错误码
+ */
+rt_err_t uplink_tls_init(void);
+
+/**
+ * 通过HTTPS发送一次GET请求
+ *
+ * 每次请求都会重新建立TCP连接，但会复用上一次握手得到的TLS会话
+ * （Session ID/Session Ticket），避免每次都做完整的ECDHE握手。
+ *
+ * @param host      服务器地址
+ * @param port      服务器端口
+ * @param path      请求路径（含查询参数）
+ * @param resp      响应正文缓冲区，可为RT_NULL
+ * @param resp_size 响应正文缓冲区大小
+ * @return 成功返回HTTP状态码，失败返回负的错误码
+ */
+int uplink_tls_get(const char *host, int port, const char *path, char *resp, rt_size_t resp_size);
+
+/**
+ * 丢弃缓存的TLS会话，下次请求做完整握手
+ */
+void uplink_tls_session_reset(void);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
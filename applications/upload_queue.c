@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         带序号的上传队列
+ */
+
+#include "upload_queue.h"  // 上传队列头文件
+#include <board.h>         // 芯片唯一ID、SysTick
+#include <time.h>
+
+/*
+ * 队列只由上传线程读写，msh命令仅读取统计值，因此不加锁。
+ * 序号只在本次运行内单调，重启后从1重新计数；服务器用启动ID区分
+ * 不同运行周期的序号空间，避免把重启后的新数据当作重复数据丢弃。
+ */
+static struct upload_record queue[UPLOAD_QUEUE_SIZE];  // 环形队列
+static rt_uint32_t head = 0;            // 队首下标
+static rt_uint32_t count = 0;           // 队列中记录数
+static rt_uint32_t next_seq = 1;        // 下一条记录的序号
+static rt_uint32_t boot_id = 0;         // 启动ID（0表示尚未生成）
+
+/* 统计数据 */
+static rt_uint32_t stat_pushed = 0;     // 生成的记录数
+static rt_uint32_t stat_acked = 0;      // 服务器确认的记录数
+static rt_uint32_t stat_dropped = 0;    // 队列满被丢弃的记录数
+static rt_uint32_t stat_rejected = 0;   // 被服务器拒绝（4xx）而丢弃的记录数
+static rt_uint32_t stat_max_depth = 0;  // 最大积压深度
+
+/**
+ * 生成一条新的采样记录并加入队列，队列满时丢弃最旧的记录
+ *
+ * @param temp  温度
+ * @param humi  湿度
+ * @param light 光照强度
+ * @return 分配给该记录的序号
+ */
+rt_uint32_t upload_queue_push(int temp, int humi, int light)
+{
+    struct upload_record *rec;  // 新记录
+
+    if (count == UPLOAD_QUEUE_SIZE) {
+        /* 断网过久，丢弃最旧的记录为新数据腾出空间 */
+        head = (head + 1) % UPLOAD_QUEUE_SIZE;
+        count--;
+        stat_dropped++;
+    }
+
+    rec = &queue[(head + count) % UPLOAD_QUEUE_SIZE];
+    rec->seq = next_seq++;
+    rec->tick = rt_tick_get();
+    rec->temp = (rt_int16_t)temp;
+    rec->humi = (rt_int16_t)humi;
+    rec->light = light;
+
+    count++;
+    stat_pushed++;
+    if (count > stat_max_depth) {
+        stat_max_depth = count;
+    }
+
+    return rec->seq;
+}
+
+/**
+ * 获取队首（最旧的）待上传记录
+ *
+ * @return 队首记录，队列为空返回RT_NULL
+ */
+struct upload_record *upload_queue_peek(void)
+{
+    return count > 0 ? &queue[head] : RT_NULL;
+}
+
+/**
+ * 队首记录已被服务器确认，从队列中移除
+ */
+void upload_queue_pop(void)
+{
+    if (count > 0) {
+        head = (head + 1) % UPLOAD_QUEUE_SIZE;
+        count--;
+        stat_acked++;
+    }
+}
+
+/**
+ * 队首记录被服务器拒绝（重发也不会成功），从队列中丢弃
+ */
+void upload_queue_reject(void)
+{
+    if (count > 0) {
+        head = (head + 1) % UPLOAD_QUEUE_SIZE;
+        count--;
+        stat_rejected++;
+    }
+}
+
+/**
+ * 获取队列中待上传的记录数
+ *
+ * @return 记录数
+ */
+rt_uint32_t upload_queue_count(void)
+{
+    return count;
+}
+
+/**
+ * 获取设备ID（由芯片唯一ID计算）
+ *
+ * @return 设备ID
+ */
+rt_uint32_t upload_queue_device_id(void)
+{
+    /* 96位唯一ID折叠为32位，同一批次芯片的低位差异较大 */
+    return HAL_GetUIDw0() ^ (HAL_GetUIDw1() * 31) ^ (HAL_GetUIDw2() * 961);
+}
+
+/**
+ * 获取启动ID
+ *
+ * 首次调用发生在WiFi关联并确认服务器可达之后，此时的tick和SysTick计数值
+ * 受关联耗时抖动影响，每次启动都不相同；RTC有效时再混入当前时间。
+ *
+ * @return 启动ID
+ */
+rt_uint32_t upload_queue_boot_id(void)
+{
+    rt_uint32_t seed;  // 随机种子
+
+    if (boot_id == 0) {
+        seed = rt_tick_get() ^ (SysTick->VAL << 12) ^ (rt_uint32_t)time(RT_NULL);
+        seed ^= upload_queue_device_id();
+        /* xorshift打散低位 */
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        boot_id = seed ? seed : 1;
+    }
+
+    return boot_id;
+}
+
+/**
+ * msh命令：查看上传队列状态
+ */
+static int upload_queue_cmd(int argc, char **argv)
+{
+    rt_kprintf("device id : %08x\n", upload_queue_device_id());
+    rt_kprintf("boot id   : %08x%s\n", boot_id, boot_id ? "" : " (not assigned yet)");
+    rt_kprintf("next seq  : %d\n", next_seq);
+    rt_kprintf("pending   : %d / %d (max %d)\n", count, UPLOAD_QUEUE_SIZE, stat_max_depth);
+    rt_kprintf("pushed    : %d\n", stat_pushed);
+    rt_kprintf("acked     : %d\n", stat_acked);
+    rt_kprintf("dropped   : %d\n", stat_dropped);
+    rt_kprintf("rejected  : %d\n", stat_rejected);
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(upload_queue_cmd, upload_queue, show pending upload records);
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         带序号的上传队列
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __UPLOAD_QUEUE_H__
+#define __UPLOAD_QUEUE_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UPLOAD_QUEUE_SIZE  64   // 队列容量（按1秒采样约可缓存1分钟断网数据）
+
+/* 一条待上传的采样记录，重试时原样重发 */
+struct upload_record {
+    rt_uint32_t seq;        // 本次启动内单调递增的序号（从1开始）
+    rt_tick_t tick;         // 采样时刻
+    rt_int16_t temp;        // 温度
+    rt_int16_t humi;        // 湿度
+    rt_int32_t light;       // 光照强度
+};
+
+/**
+ * 生成一条新的采样记录并加入队列，队列满时丢弃最旧的记录
+ *
+ * 仅由上传线程调用。
+ *
+ * @param temp  温度
+ * @param humi  湿度
+ * @param light 光照强度
+ * @return 分配给该记录的序号
+ */
+rt_uint32_t upload_queue_push(int temp, int humi, int light);
+
+/**
+ * 获取队首（最旧的）待上传记录
+ *
+ * @return 队首记录，队列为空返回RT_NULL
+ */
+struct upload_record *upload_queue_peek(void);
+
+/**
+ * 队首记录已被服务器确认，从队列中移除
+ */
+void upload_queue_pop(void);
+
+/**
+ * 队首记录被服务器拒绝（重发也不会成功），从队列中丢弃
+ */
+void upload_queue_reject(void);
+
+/**
+ * 获取队列中待上传的记录数
+ *
+ * @return 记录数
+ */
+rt_uint32_t upload_queue_count(void);
+
+/**
+ * 获取设备ID（由芯片唯一ID计算）
+ *
+ * @return 设备ID
+ */
+rt_uint32_t upload_queue_device_id(void);
+
+/**
+ * 获取启动ID，服务器按(设备ID, 启动ID)区分序号空间
+ *
+ * 首次调用时生成，此后本次运行内保持不变。
+ *
+ * @return 启动ID
+ */
+rt_uint32_t upload_queue_boot_id(void);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
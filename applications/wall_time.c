@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         节拍加SysTick计数的微秒时间
+ */
+
+#include "wall_time.h"     // 微秒时间头文件
+#include <board.h>         // SysTick寄存器
+
+/**
+ * 获取自系统节拍启动以来的微秒数（节拍加SysTick当前计数）
+ *
+ * SysTick以HCLK向下计数，节拍内已经过的时间按剩余计数和当前主频换算，而不是按LOAD的比例：
+ * clock_scale切换档位时把当前节拍剩余的部分按新主频临时装入LOAD，这一拍内LOAD不是整拍，
+ * 按比例换算会让时间倒退。
+ */
+rt_uint32_t wall_time_us(void)
+{
+    rt_base_t level;
+    rt_tick_t tick;
+    rt_uint32_t val, part;
+
+    level = rt_hw_interrupt_disable();
+    tick = rt_tick_get();
+    val = SysTick->VAL;
+    /* 计数已回绕但节拍中断尚未处理：新的一拍刚开始 */
+    if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+        tick++;
+        part = 0;
+    } else {
+        part = 1000000 / RT_TICK_PER_SECOND - val / (SystemCoreClock / 1000000);
+    }
+    rt_hw_interrupt_enable(level);
+
+    return tick * (1000000 / RT_TICK_PER_SECOND) + part;
+}
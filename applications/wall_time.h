@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         节拍加SysTick计数的微秒时间
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __WALL_TIME_H__
+#define __WALL_TIME_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 获取自系统节拍启动以来的微秒数（节拍加SysTick当前计数）
+ *
+ * 与DWT周期计数不同，结果与clock_scale档位无关，WFI期间照常计时，
+ * STOP醒来后按lowpower补偿的节拍继续，32位回绕周期约71分钟。
+ * 可在关中断或中断中调用。
+ *
+ * @return 微秒数
+ */
+rt_uint32_t wall_time_us(void);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
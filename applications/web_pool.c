@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         webclient固定大小内存池
+ */
+
+#include <rtthread.h>
+#include <stdlib.h>
+#include "web_pool.h"      // webclient内存池头文件
+#include "mem_region.h"    // 多区域内存分配
+
+/*
+ * 尺寸档配置
+ *
+ * 每次上传webclient会分配：会话结构体、响应头描述（小对象）、主机名和请求URL
+ * （字符串）以及webclient_session_create(1024)的响应头缓冲区，请求结束后全部释放。
+ * 改用固定大小内存池后分配/释放为常数时间，且不会在系统堆中留下碎片。
+ */
+static const struct {
+    rt_size_t block_size;   // 块大小
+    rt_size_t block_count;  // 块数量
+} web_pool_cfg[] = {
+    {64,   8},  // 会话、响应头描述、主机名等小对象
+    {256,  4},  // 请求URL
+    {1024, 2},  // 响应头缓冲区
+};
+
+#define WEB_POOL_CLASSES    (sizeof(web_pool_cfg) / sizeof(web_pool_cfg[0]))
+#define WEB_POOL_BLOCK_HDR  sizeof(rt_uint8_t *)    // rt_mempool每块前的管理指针
+
+/* 每个尺寸档的内存池与统计 */
+struct web_pool_class {
+    struct rt_mempool pool;     // 内存池
+    rt_uint8_t *start;          // 池内存起始地址
+    rt_uint8_t *end;            // 池内存结束地址
+    rt_uint32_t allocs;         // 从本档成功分配次数
+    rt_uint32_t misses;         // 本档用尽、退回系统堆的次数
+    rt_uint32_t min_free;       // 空闲块数的最低值
+};
+
+static struct web_pool_class classes[WEB_POOL_CLASSES];
+static rt_bool_t pool_ready = RT_FALSE;
+static rt_uint32_t oversize = 0;    // 超过最大尺寸档、直接走系统堆的次数
+static rt_uint32_t failures = 0;    // 退回系统堆后仍然失败的次数
+
+/**
+ * 初始化各尺寸档的内存池（池内存从CCM分配）
+ *
+ * @return 成功返回0，失败返回负的错误码
+ */
+int web_pool_init(void)
+{
+    struct web_pool_class *cls;
+    rt_size_t bytes;
+    char name[RT_NAME_MAX];
+    int i;
+
+    for (i = 0; i < WEB_POOL_CLASSES; i++) {
+        cls = &classes[i];
+        bytes = (web_pool_cfg[i].block_size + WEB_POOL_BLOCK_HDR) * web_pool_cfg[i].block_count;
+
+        /* 池内存只由CPU访问（lwIP发送时会复制数据），放在CCM中节省片内SRAM */
+        cls->start = mem_region_alloc(MEM_HINT_FAST, bytes);
+        if (cls->start == RT_NULL) {
+            rt_kprintf("[WPOOL] No memory for %d-byte pool\n", web_pool_cfg[i].block_size);
+            return -RT_ENOMEM;
+        }
+        cls->end = cls->start + bytes;
+
+        rt_snprintf(name, sizeof(name), "web%d", web_pool_cfg[i].block_size);
+        rt_mp_init(&cls->pool, name, cls->start, bytes, web_pool_cfg[i].block_size);
+        cls->min_free = cls->pool.block_free_count;
+    }
+    pool_ready = RT_TRUE;
+
+    return RT_EOK;
+}
+
+/**
+ * 查找地址所属的尺寸档
+ */
+static struct web_pool_class *web_pool_owner(void *ptr)
+{
+    int i;
+
+    for (i = 0; i < WEB_POOL_CLASSES; i++) {
+        if ((rt_uint8_t *)ptr >= classes[i].start && (rt_uint8_t *)ptr < classes[i].end) {
+            return &classes[i];
+        }
+    }
+    return RT_NULL;
+}
+
+/**
+ * 从能容纳size的最小尺寸档分配，该档用尽时退回系统堆并计数
+ *
+ * @param size 字节数
+ * @return 成功返回内存地址，失败返回NULL
+ */
+void *web_pool_malloc(size_t size)
+{
+    struct web_pool_class *cls;
+    void *ptr;
+    int i;
+
+    if (pool_ready) {
+        for (i = 0; i < WEB_POOL_CLASSES; i++) {
+            if (size > web_pool_cfg[i].block_size) {
+                continue;
+            }
+
+            cls = &classes[i];
+            ptr = rt_mp_alloc(&cls->pool, RT_WAITING_NO);
+            if (ptr != RT_NULL) {
+                cls->allocs++;
+                if (cls->pool.block_free_count < cls->min_free) {
+                    cls->min_free = cls->pool.block_free_count;
+                }
+                return ptr;
+            }
+            cls->misses++;
+            break;
+        }
+        if (i == WEB_POOL_CLASSES) {
+            oversize++;
+        }
+    }
+
+    ptr = rt_malloc(size);
+    if (ptr == RT_NULL) {
+        failures++;
+    }
+    return ptr;
+}
+
+/**
+ * 分配并清零
+ */
+void *web_pool_calloc(size_t count, size_t size)
+{
+    void *ptr = web_pool_malloc(count * size);
+
+    if (ptr != RT_NULL) {
+        rt_memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+/**
+ * 调整大小，新大小不超过原尺寸档时原地返回
+ */
+void *web_pool_realloc(void *ptr, size_t size)
+{
+    struct web_pool_class *cls;
+    rt_size_t block_size;
+    void *new_ptr;
+
+    if (ptr == RT_NULL) {
+        return web_pool_malloc(size);
+    }
+
+    cls = web_pool_owner(ptr);
+    if (cls == RT_NULL) {
+        return rt_realloc(ptr, size);
+    }
+
+    block_size = cls->pool.block_size;
+    if (size <= block_size) {
+        return ptr;
+    }
+
+    new_ptr = web_pool_malloc(size);
+    if (new_ptr != RT_NULL) {
+        rt_memcpy(new_ptr, ptr, block_size);
+        rt_mp_free(ptr);
+    }
+    return new_ptr;
+}
+
+/**
+ * 释放（按地址判断属于内存池还是系统堆）
+ */
+void web_pool_free(void *ptr)
+{
+    if (ptr == RT_NULL) {
+        return;
+    }
+
+    if (web_pool_owner(ptr) != RT_NULL) {
+        rt_mp_free(ptr);
+    } else {
+        rt_free(ptr);
+    }
+}
+
+/**
+ * 复制字符串
+ */
+char *web_pool_strdup(const char *s)
+{
+    rt_size_t len = rt_strlen(s) + 1;
+    char *ptr = web_pool_malloc(len);
+
+    if (ptr != RT_NULL) {
+        rt_memcpy(ptr, s, len);
+    }
+    return ptr;
+}
+
+/**
+ * msh命令：输出各尺寸档的使用情况
+ *
+ * misses不为0说明该档块数不足，min free长期大于0说明块数可以减少。
+ */
+static int web_pool(int argc, char **argv)
+{
+    int i;
+
+    if (!pool_ready) {
+        rt_kprintf("[WPOOL] Not initialized\n");
+        return -RT_ERROR;
+    }
+
+    rt_kprintf("%6s %6s %6s %8s %8s %8s\n", "block", "total", "free", "min free", "allocs", "misses");
+    for (i = 0; i < WEB_POOL_CLASSES; i++) {
+        rt_kprintf("%6d %6d %6d %8d %8d %8d\n", web_pool_cfg[i].block_size, classes[i].pool.block_total_count,
+                   classes[i].pool.block_free_count, classes[i].min_free, classes[i].allocs, classes[i].misses);
+    }
+    rt_kprintf("oversize: %d, heap failures: %d\n", oversize, failures);
+
+    return 0;
+}
+MSH_CMD_EXPORT(web_pool, show webclient memory pool usage);
+
+/**
+ * 通过二分查找测出系统堆当前能分配的最大连续块
+ */
+static rt_size_t web_pool_largest_free(void)
+{
+    rt_size_t lo = 0, hi, mid;
+    rt_size_t total, used, max_used;
+    void *ptr;
+
+    rt_memory_info(&total, &used, &max_used);
+    hi = total - used;
+    while (lo + 16 < hi) {
+        mid = (lo + hi) / 2;
+        ptr = rt_malloc(mid);
+        if (ptr != RT_NULL) {
+            rt_free(ptr);
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * msh命令：长时间模拟上传时的分配模式，观察系统堆碎片
+ *
+ * 用法：web_soak <heap|pool> [轮数]
+ * 每轮按webclient的顺序分配会话、响应头描述、1024字节缓冲区、主机名和URL再全部释放；
+ * 每50轮另外分配一块长期持有的小内存（模拟其它模块，保留16块后先进先出释放），
+ * 它会落在上传对象释放后留下的空洞之间。heap模式下最大可分配块随时间下降，
+ * pool模式下上传对象不再进入系统堆，最大可分配块保持平稳。
+ */
+static int web_soak(int argc, char **argv)
+{
+    void *(*alloc)(size_t);
+    void (*release)(void *);
+    void *session, *header, *buffer, *host, *url;
+    void *keep[16] = {RT_NULL};
+    rt_size_t total, used, max_used;
+    int rounds = 20000, keep_idx = 0, i;
+
+    if (argc < 2 || (rt_strcmp(argv[1], "heap") != 0 && rt_strcmp(argv[1], "pool") != 0)) {
+        rt_kprintf("Usage: web_soak <heap|pool> [rounds]\n");
+        return -RT_EINVAL;
+    }
+    if (rt_strcmp(argv[1], "pool") == 0) {
+        alloc = web_pool_malloc;
+        release = web_pool_free;
+    } else {
+        alloc = malloc;
+        release = free;
+    }
+    if (argc > 2 && atoi(argv[2]) > 0) {
+        rounds = atoi(argv[2]);
+    }
+
+    rt_kprintf("%8s %8s %8s %12s\n", "round", "used", "max", "largest free");
+    for (i = 1; i <= rounds; i++) {
+        session = alloc(48);
+        header = alloc(12);
+        buffer = alloc(1024);
+        host = alloc(16);
+        url = alloc(150 + i % 40);
+
+        if (i % 50 == 0) {
+            rt_free(keep[keep_idx]);
+            keep[keep_idx] = rt_malloc(24 + i % 64);
+            keep_idx = (keep_idx + 1) % 16;
+        }
+
+        release(url);
+        release(host);
+        release(buffer);
+        release(header);
+        release(session);
+
+        if (i % (rounds / 10 ? rounds / 10 : 1) == 0) {
+            rt_memory_info(&total, &used, &max_used);
+            rt_kprintf("%8d %8d %8d %12d\n", i, used, max_used, web_pool_largest_free());
+        }
+    }
+
+    for (i = 0; i < 16; i++) {
+        rt_free(keep[i]);
+    }
+    return 0;
+}
+MSH_CMD_EXPORT(web_soak, soak test heap fragmentation for webclient allocations);
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         webclient固定大小内存池
+ */
+
+/*
+ * 本头文件由applications/SConscript（或.cproject的Include files）强制包含到每个编译单元，
+ * 使webclient软件包的web_malloc/web_calloc/web_realloc/web_free/web_strdup
+ * 改为从固定大小内存池分配。因此这里只依赖<stddef.h>，不包含rtthread.h。
+ * 强制包含时rtconfig.h尚未包含，重定义由同时传入的-DWEB_USING_POOL打开。
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __WEB_POOL_H__
+#define __WEB_POOL_H__
+
+#include <stddef.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 初始化各尺寸档的内存池（池内存从CCM分配）
+ *
+ * 初始化之前的分配直接走系统堆。
+ *
+ * @return 成功返回0，失败返回负的错误码
+ */
+int web_pool_init(void);
+
+/**
+ * 从能容纳size的最小尺寸档分配，该档用尽时退回系统堆并计数
+ *
+ * @param size 字节数
+ * @return 成功返回内存地址，失败返回NULL
+ */
+void *web_pool_malloc(size_t size);
+
+/**
+ * 分配并清零
+ */
+void *web_pool_calloc(size_t count, size_t size);
+
+/**
+ * 调整大小，新大小不超过原尺寸档时原地返回
+ */
+void *web_pool_realloc(void *ptr, size_t size);
+
+/**
+ * 释放（按地址判断属于内存池还是系统堆）
+ */
+void web_pool_free(void *ptr);
+
+/**
+ * 复制字符串
+ */
+char *web_pool_strdup(const char *s);
+
+#ifdef WEB_USING_POOL
+#define web_malloc      web_pool_malloc
+#define web_calloc      web_pool_calloc
+#define web_realloc     web_pool_realloc
+#define web_free        web_pool_free
+#define web_strdup      web_pool_strdup
+#endif
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         WiFi快速重连缓存
+ */
+
+#include "wifi_cache.h"    // WiFi缓存头文件
+#include "net_state.h"     // 网络连接状态机
+#include <rtdevice.h>      // RT设备驱动框架
+#include <board.h>         // 板级支持包（Flash参数区定义）
+
+#include <wlan_mgnt.h>
+#include <netdev.h>
+#include <lwip/netif.h>
+#include <lwip/dhcp.h>
+#include <lwip/prot/dhcp.h>
+#include <stddef.h>
+#include <time.h>
+
+#define WIFI_CACHE_MAGIC       0x57434331  // 记录魔数 "WCC1"
+#define WIFI_CACHE_ERASED      0xFFFFFFFF  // Flash擦除后的值
+#define WIFI_CACHE_SLOT_SIZE   128         // 每条记录占用的Flash空间
+#define WIFI_CACHE_SLOTS       (STM32_FLASH_PARAM_SIZE / WIFI_CACHE_SLOT_SIZE)
+#define WIFI_NETDEV_NAME       "w0"        // WiFi对应的网卡名称
+#define WIFI_LEASE_REFRESH_DIV 4           // 租约过去1/4后才重新写入Flash，减少擦写
+
+/* Flash中的缓存记录，按槽追加写入，扇区写满后整体擦除 */
+struct wifi_cache_record {
+    rt_uint32_t magic;          // 记录魔数
+    char ssid[36];              // 热点名称
+    rt_uint8_t bssid[6];        // 热点MAC地址
+    rt_int16_t channel;         // 信道
+    rt_uint32_t security;       // 加密方式
+    rt_uint32_t band;           // 频段
+    rt_uint32_t ip_addr;        // 租约IP地址
+    rt_uint32_t gw_addr;        // 网关
+    rt_uint32_t netmask;        // 子网掩码
+    rt_uint32_t dns_addr;       // DNS服务器
+    rt_uint32_t lease_time;     // 租约时长(s)，0表示未知
+    rt_uint32_t lease_start;    // 获取租约时的RTC时间(s)，0表示未知
+    rt_uint32_t crc;            // 以上字段的CRC32
+};
+
+static struct wifi_cache_record cache_record;  // 当前有效记录的RAM副本
+static rt_int32_t cache_slot = -1;             // 当前有效记录所在槽，-1表示无记录
+static rt_bool_t lease_reused = RT_FALSE;      // 本次连接是否复用了缓存租约
+static rt_bool_t cache_stale = RT_FALSE;       // 定向连接失败后停用缓存，直到重新写入
+static volatile rt_bool_t erase_due = RT_FALSE;  // 扇区已写满，等待空闲时擦除
+static struct wifi_cache_record erase_pending;  // 擦除完成后写入的记录
+
+/* 快速路径统计 */
+static rt_uint32_t fast_connect_ok = 0;        // 定向连接成功次数
+static rt_uint32_t fast_connect_fail = 0;      // 定向连接失败次数
+static rt_uint32_t lease_reuse_count = 0;      // 租约复用次数
+static rt_uint32_t flash_write_count = 0;      // 本次启动写Flash次数
+
+/**
+ * 计算CRC32（多项式0xEDB88320）
+ */
+static rt_uint32_t wifi_cache_crc32(const void *data, rt_size_t len)
+{
+    const rt_uint8_t *p = (const rt_uint8_t *)data;
+    rt_uint32_t crc = 0xFFFFFFFF;
+    int i;
+
+    while (len--) {
+        crc ^= *p++;
+        for (i = 0; i < 8; i++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (-(crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * 获取指定槽的Flash地址
+ */
+rt_inline const struct wifi_cache_record *wifi_cache_slot_addr(rt_int32_t slot)
+{
+    return (const struct wifi_cache_record *)(STM32_FLASH_PARAM_ADDRESS + slot * WIFI_CACHE_SLOT_SIZE);
+}
+
+/**
+ * 从Flash加载最后一条有效记录
+ */
+static void wifi_cache_load(void)
+{
+    const struct wifi_cache_record *rec;
+    rt_int32_t slot;
+
+    cache_slot = -1;
+    for (slot = 0; slot < WIFI_CACHE_SLOTS; slot++) {
+        rec = wifi_cache_slot_addr(slot);
+        if (rec->magic == WIFI_CACHE_ERASED) {
+            break;  // 之后的槽均未写入
+        }
+        if (rec->magic == WIFI_CACHE_MAGIC
+                && rec->crc == wifi_cache_crc32(rec, offsetof(struct wifi_cache_record, crc))) {
+            rt_memcpy(&cache_record, rec, sizeof(cache_record));
+            cache_slot = slot;
+        }
+    }
+}
+
+/**
+ * 擦除参数扇区
+ *
+ * 参数扇区（128KB）与代码在同一个Flash bank，擦除期间取指令和读Flash都会被挂起，
+ * CPU（包括中断）停顿约1~2秒，与调用线程的优先级无关。写满一个扇区需要1024次写入，
+ * 正常情况下很少发生；写满时推迟到系统空闲时擦除，见wifi_cache_flush()。
+ */
+static rt_err_t wifi_cache_erase(void)
+{
+    FLASH_EraseInitTypeDef erase = {0};
+    rt_uint32_t sector_error = 0;
+    HAL_StatusTypeDef status;
+
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.Sector = STM32_FLASH_PARAM_SECTOR;
+    erase.NbSectors = 1;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR
+                           | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+    status = HAL_FLASHEx_Erase(&erase, &sector_error);
+    HAL_FLASH_Lock();
+
+    cache_slot = -1;
+    return (status == HAL_OK) ? RT_EOK : -RT_EIO;
+}
+
+/**
+ * 把记录写入指定的空槽
+ */
+static rt_err_t wifi_cache_program(rt_int32_t slot, const struct wifi_cache_record *rec)
+{
+    const rt_uint32_t *src = (const rt_uint32_t *)rec;
+    rt_uint32_t addr;
+    rt_size_t i;
+
+    addr = (rt_uint32_t)wifi_cache_slot_addr(slot);
+    HAL_FLASH_Unlock();
+    for (i = 0; i < sizeof(*rec) / sizeof(rt_uint32_t); i++) {
+        if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, addr + i * 4, src[i]) != HAL_OK) {
+            break;
+        }
+    }
+    HAL_FLASH_Lock();
+
+    if (rt_memcmp((const void *)addr, rec, sizeof(*rec)) != 0) {
+        return -RT_EIO;
+    }
+
+    rt_memcpy(&cache_record, rec, sizeof(cache_record));
+    cache_slot = slot;
+    flash_write_count++;
+    return RT_EOK;
+}
+
+/**
+ * 把记录追加写入下一个空槽，扇区写满时记下该记录，等系统空闲时擦除后再写
+ *
+ * 等待擦除期间Flash中的最后一条记录仍然有效，定向连接照常使用它。
+ *
+ * @param rec 待写入记录（magic和crc字段由本函数填写）
+ * @return 成功返回RT_EOK（含推迟写入），失败返回错误码
+ */
+static rt_err_t wifi_cache_write(struct wifi_cache_record *rec)
+{
+    rt_int32_t slot = cache_slot + 1;
+    rt_base_t level;
+
+    rec->magic = WIFI_CACHE_MAGIC;
+    rec->crc = wifi_cache_crc32(rec, offsetof(struct wifi_cache_record, crc));
+
+    if (erase_due || slot >= WIFI_CACHE_SLOTS || wifi_cache_slot_addr(slot)->magic != WIFI_CACHE_ERASED) {
+        /* 空闲钩子在关中断时读取待写记录，拷贝过程中不能被打断 */
+        level = rt_hw_interrupt_disable();
+        rt_memcpy(&erase_pending, rec, sizeof(erase_pending));
+        erase_due = RT_TRUE;
+        rt_hw_interrupt_enable(level);
+        return RT_EOK;
+    }
+    return wifi_cache_program(slot, rec);
+}
+
+/**
+ * 是否有等待擦除扇区后才能写入的记录
+ */
+rt_bool_t wifi_cache_erase_due(void)
+{
+    return erase_due;
+}
+
+/**
+ * 擦除写满的参数扇区并写入待写记录
+ *
+ * 由低功耗空闲钩子在即将进入STOP、且没有待上传记录时调用（已关中断），
+ * 这时所有线程都在等待至少WIFI_CACHE_ERASE_MS之后的定时器，擦除造成的停顿不会推迟任何工作。
+ * 停顿期间节拍中断无法响应，调用者需按RTC补偿节拍。
+ */
+void wifi_cache_flush(void)
+{
+    if (!erase_due) {
+        return;
+    }
+
+    if (wifi_cache_erase() == RT_EOK) {
+        if (wifi_cache_program(0, &erase_pending) == RT_EOK) {
+            cache_stale = RT_FALSE;
+        }
+    } else {
+        rt_kprintf("[WIFI] Failed to erase cache sector\n");
+    }
+    erase_due = RT_FALSE;
+}
+
+/**
+ * 判断缓存租约是否仍在有效期前半段
+ *
+ * time()来自板级RTC驱动（BSP_USING_ONCHIP_RTC，LSE），复位后日历时间继续走；
+ * 备份域掉电后RTC回到默认时间，判断可能出错，此时服务器不可达，wifi_cache_verify()会交回DHCP。
+ */
+static rt_bool_t wifi_cache_lease_fresh(const struct wifi_cache_record *rec)
+{
+    time_t now = time(RT_NULL);
+
+    if (rec->lease_time == 0 || rec->lease_start == 0 || now <= 0) {
+        return RT_FALSE;
+    }
+    if ((rt_uint32_t)now < rec->lease_start) {
+        return RT_FALSE;  // RTC被复位，无法判断租约年龄
+    }
+    return ((rt_uint32_t)now - rec->lease_start) < rec->lease_time / 2;
+}
+
+/**
+ * 把缓存租约作为静态地址应用到网卡
+ */
+static rt_err_t wifi_cache_apply_lease(const struct wifi_cache_record *rec)
+{
+    struct netdev *netdev = netdev_get_by_name(WIFI_NETDEV_NAME);
+    ip_addr_t addr;
+
+    if (netdev == RT_NULL) {
+        return -RT_ERROR;
+    }
+
+    netdev_dhcp_enabled(netdev, RT_FALSE);
+
+    ip4_addr_set_u32(&addr, rec->ip_addr);
+    netdev_set_ipaddr(netdev, &addr);
+    ip4_addr_set_u32(&addr, rec->netmask);
+    netdev_set_netmask(netdev, &addr);
+    ip4_addr_set_u32(&addr, rec->gw_addr);
+    netdev_set_gw(netdev, &addr);
+    ip4_addr_set_u32(&addr, rec->dns_addr);
+    netdev_set_dns_server(netdev, 0, &addr);
+
+    return RT_EOK;
+}
+
+/**
+ * 使用Flash中缓存的BSSID/信道定向连接热点（跳过扫描）
+ *
+ * @param ssid     热点名称
+ * @param password 热点密码
+ * @return 关联成功返回RT_EOK，无缓存返回-RT_EEMPTY，关联失败返回错误码
+ */
+rt_err_t wifi_cache_connect(const char *ssid, const char *password)
+{
+    struct rt_wlan_info info;  // 定向连接参数
+    rt_err_t result;           // 函数返回值
+
+    RT_ASSERT(ssid != RT_NULL);
+
+    lease_reused = RT_FALSE;
+
+    if (cache_slot < 0) {
+        wifi_cache_load();
+    }
+    if (cache_slot < 0 || cache_stale
+            || rt_strncmp(cache_record.ssid, ssid, sizeof(cache_record.ssid)) != 0) {
+        return -RT_EEMPTY;
+    }
+
+    rt_memset(&info, 0, sizeof(info));
+    info.security = (rt_wlan_security_t)cache_record.security;
+    info.band = (rt_802_11_band_t)cache_record.band;
+    info.channel = cache_record.channel;
+    rt_memcpy(info.bssid, cache_record.bssid, sizeof(info.bssid));
+    info.ssid.len = rt_strlen(cache_record.ssid);
+    rt_memcpy(info.ssid.val, cache_record.ssid, info.ssid.len);
+
+    rt_kprintf("[WIFI] Fast connect: %s ch%d %02x:%02x:%02x:%02x:%02x:%02x\n",
+               cache_record.ssid, cache_record.channel,
+               info.bssid[0], info.bssid[1], info.bssid[2],
+               info.bssid[3], info.bssid[4], info.bssid[5]);
+
+    result = rt_wlan_connect_adv(&info, password);
+    if (result != RT_EOK) {
+        /* 热点可能已更换信道或BSSID，下次直接走扫描路径 */
+        fast_connect_fail++;
+        cache_stale = RT_TRUE;
+        return result;
+    }
+    fast_connect_ok++;
+
+    /* 租约仍新鲜：直接复用，不等待DHCP */
+    if (wifi_cache_lease_fresh(&cache_record) && wifi_cache_apply_lease(&cache_record) == RT_EOK) {
+        lease_reused = RT_TRUE;
+        lease_reuse_count++;
+        net_state_set(NET_STATE_IP_ACQUIRED);
+    }
+
+    return RT_EOK;
+}
+
+/**
+ * 把当前热点信息和DHCP租约写入缓存
+ */
+static void wifi_cache_update(void)
+{
+    struct wifi_cache_record rec;  // 新记录
+    struct rt_wlan_info info;      // 当前热点信息
+    struct netdev *netdev;         // WiFi网卡
+    struct dhcp *dhcp;             // lwIP DHCP状态
+    time_t now = time(RT_NULL);
+
+    netdev = netdev_get_by_name(WIFI_NETDEV_NAME);
+    if (netdev == RT_NULL || rt_wlan_get_info(&info) != RT_EOK) {
+        return;
+    }
+
+    rt_memset(&rec, 0, sizeof(rec));
+    rt_memcpy(rec.ssid, info.ssid.val, info.ssid.len < sizeof(rec.ssid) - 1 ? info.ssid.len : sizeof(rec.ssid) - 1);
+    rt_memcpy(rec.bssid, info.bssid, sizeof(rec.bssid));
+    rec.channel = info.channel;
+    rec.security = info.security;
+    rec.band = info.band;
+    rec.ip_addr = ip4_addr_get_u32(&netdev->ip_addr);
+    rec.gw_addr = ip4_addr_get_u32(&netdev->gw);
+    rec.netmask = ip4_addr_get_u32(&netdev->netmask);
+    rec.dns_addr = ip4_addr_get_u32(&netdev->dns_servers[0]);
+
+    dhcp = netif_dhcp_data((struct netif *)netdev->user_data);
+    if (dhcp != RT_NULL && dhcp->state == DHCP_STATE_BOUND && now > 0) {
+        rec.lease_time = dhcp->offered_t0_lease;
+        rec.lease_start = (rt_uint32_t)now;
+    }
+
+    /* 热点和地址未变、且租约时长未知（无需刷新时间戳）或时间戳不算太旧时不写Flash */
+    if (cache_slot >= 0 && !cache_stale
+            && rt_memcmp(&rec.ssid, &cache_record.ssid,
+                         offsetof(struct wifi_cache_record, lease_time) - offsetof(struct wifi_cache_record, ssid)) == 0
+            && rec.lease_time == cache_record.lease_time
+            && (rec.lease_time == 0
+                || rec.lease_start - cache_record.lease_start < cache_record.lease_time / WIFI_LEASE_REFRESH_DIV)) {
+        return;
+    }
+
+    if (wifi_cache_write(&rec) != RT_EOK) {
+        rt_kprintf("[WIFI] Failed to write cache\n");
+        return;
+    }
+    cache_stale = RT_FALSE;
+}
+
+/**
+ * 连接后确认服务器可达，并更新缓存
+ *
+ * @param timeout 等待服务器可达的超时时间（tick）
+ * @return 服务器可达返回RT_EOK，超时返回-RT_ETIMEOUT
+ */
+rt_err_t wifi_cache_verify(rt_int32_t timeout)
+{
+    rt_err_t result = net_state_wait(NET_STATE_REACHABLE, timeout);
+
+    if (lease_reused) {
+        struct netdev *netdev = netdev_get_by_name(WIFI_NETDEV_NAME);
+
+        /* 可达时在后台重新走DHCP续约，地址在续约期间保持可用；
+         * 不可达说明缓存租约已失效，同样交回DHCP重新获取 */
+        lease_reused = RT_FALSE;
+        if (netdev != RT_NULL) {
+            netdev_dhcp_enabled(netdev, RT_TRUE);
+        }
+        return result;
+    }
+
+    if (result == RT_EOK) {
+        wifi_cache_update();
+    }
+    return result;
+}
+
+/**
+ * msh命令：显示缓存内容及快速路径统计，"wifi_cache clear"擦除缓存（CPU停顿1~2秒）
+ */
+static int wifi_cache_cmd(int argc, char **argv)
+{
+    if (argc > 1 && rt_strcmp(argv[1], "clear") == 0) {
+        erase_due = RT_FALSE;  // 丢弃待写记录
+        return wifi_cache_erase();
+    }
+
+    if (cache_slot < 0) {
+        wifi_cache_load();
+    }
+
+    if (cache_slot < 0) {
+        rt_kprintf("cache   : empty\n");
+    } else {
+        rt_kprintf("cache   : slot %d/%d\n", cache_slot, WIFI_CACHE_SLOTS);
+        rt_kprintf("ap      : %s ch%d %02x:%02x:%02x:%02x:%02x:%02x\n",
+                   cache_record.ssid, cache_record.channel,
+                   cache_record.bssid[0], cache_record.bssid[1], cache_record.bssid[2],
+                   cache_record.bssid[3], cache_record.bssid[4], cache_record.bssid[5]);
+        rt_kprintf("lease   : %d.%d.%d.%d, %d s, fresh %s\n",
+                   cache_record.ip_addr & 0xFF, (cache_record.ip_addr >> 8) & 0xFF,
+                   (cache_record.ip_addr >> 16) & 0xFF, cache_record.ip_addr >> 24,
+                   cache_record.lease_time, wifi_cache_lease_fresh(&cache_record) ? "yes" : "no");
+    }
+    rt_kprintf("fast    : ok %d, fail %d, lease reused %d\n",
+               fast_connect_ok, fast_connect_fail, lease_reuse_count);
+    rt_kprintf("flash   : %d writes since boot%s\n", flash_write_count, erase_due ? ", erase pending" : "");
+
+    return 0;
+}
+MSH_CMD_EXPORT_ALIAS(wifi_cache_cmd, wifi_cache, show or clear cached AP and DHCP lease);
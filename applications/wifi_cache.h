@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2006-2021, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-18      Mik         WiFi快速重连缓存
+ */
+
+// 头文件保护，防止重复包含
+#ifndef __WIFI_CACHE_H__
+#define __WIFI_CACHE_H__
+
+// RT核心头文件
+#include <rtthread.h>
+
+// C++编译兼容性声明
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 使用Flash中缓存的BSSID/信道定向连接热点（跳过扫描）
+ *
+ * 缓存的DHCP租约仍在有效期前半段时直接复用，无需等待DHCP。
+ *
+ * @param ssid     热点名称
+ * @param password 热点密码
+ * @return 关联成功返回RT_EOK，无缓存返回-RT_EEMPTY，关联失败返回错误码
+ */
+rt_err_t wifi_cache_connect(const char *ssid, const char *password);
+
+/**
+ * 连接后确认服务器可达，并更新缓存
+ *
+ * 可达时：复用了租约则在后台重新启用DHCP续约，否则把当前热点和租约写入Flash；
+ * 超时时：复用了租约则放弃该租约，重新启用DHCP。
+ *
+ * @param timeout 等待服务器可达的超时时间（tick）
+ * @return 服务器可达返回RT_EOK，超时返回-RT_ETIMEOUT
+ */
+rt_err_t wifi_cache_verify(rt_int32_t timeout);
+
+/* 擦除参数扇区时CPU停顿的最长时间(ms)，128KB扇区典型1秒、最长2秒 */
+#define WIFI_CACHE_ERASE_MS    2000
+
+/**
+ * 是否有等待擦除扇区后才能写入的记录
+ *
+ * @return 参数扇区已写满、待写记录尚未写入时返回RT_TRUE
+ */
+rt_bool_t wifi_cache_erase_due(void);
+
+/**
+ * 擦除写满的参数扇区并写入待写记录
+ *
+ * 擦除期间取指令被挂起，CPU和所有中断停顿最长WIFI_CACHE_ERASE_MS。
+ * 只能在系统空闲、且确定该时间内没有工作要做时调用（关中断调用）。
+ */
+void wifi_cache_flush(void);
+
+// 结束C++兼容性声明
+#ifdef __cplusplus
+}
+#endif
+
+// 结束头文件保护
+#endif
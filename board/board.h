@@ -27,6 +27,11 @@ extern "C" {
 #define STM32_FLASH_SIZE             (1024 * 1024)
 #define STM32_FLASH_END_ADDRESS      ((uint32_t)(STM32_FLASH_START_ADRESS + STM32_FLASH_SIZE))
 
+/* the last 128KB sector (sector 11) is kept out of the linker scripts for parameter storage */
+#define STM32_FLASH_PARAM_ADDRESS    ((uint32_t)0x080E0000)
+#define STM32_FLASH_PARAM_SIZE       (128 * 1024)
+#define STM32_FLASH_PARAM_SECTOR     FLASH_SECTOR_11
+
 #if defined(__ARMCC_VERSION)
 extern int Image$$RW_IRAM1$$ZI$$Limit;
 #define HEAP_BEGIN      ((void *)&Image$$RW_IRAM1$$ZI$$Limit)
@@ -40,6 +45,34 @@ extern int __bss_end;
 
 #define HEAP_END        STM32_SRAM_END
 
+/* 64KB CCM RAM: CPU-only (not reachable by DMA), free space starts after the .ccmram section */
+#define STM32_CCMRAM_BEGIN      (0x10000000)
+#define STM32_CCMRAM_END        (STM32_CCMRAM_BEGIN + 64 * 1024)
+
+#if defined(__ARMCC_VERSION)
+extern int Image$$RW_IRAM2$$ZI$$Limit;
+#define CCM_HEAP_BEGIN  ((void *)&Image$$RW_IRAM2$$ZI$$Limit)
+#elif __ICCARM__
+#pragma section=".ccmram"
+#define CCM_HEAP_BEGIN  (__section_end(".ccmram"))
+#else
+extern int __ccmram_free__;
+#define CCM_HEAP_BEGIN  ((void *)&__ccmram_free__)
+#endif
+#define CCM_HEAP_END    ((void *)STM32_CCMRAM_END)
+
+/* 1MB external SRAM on FSMC bank1 NE3, initialized by drv_sram before main */
+#define STM32_EXT_SRAM_BEGIN    (0x68000000)
+#define STM32_EXT_SRAM_END      (STM32_EXT_SRAM_BEGIN + 1024 * 1024)
+
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+extern int __MCUlcdgrambysram_free__;
+#define EXT_SRAM_HEAP_BEGIN ((void *)&__MCUlcdgrambysram_free__)
+#else
+#define EXT_SRAM_HEAP_BEGIN ((void *)STM32_EXT_SRAM_BEGIN)
+#endif
+#define EXT_SRAM_HEAP_END   ((void *)STM32_EXT_SRAM_END)
+
 void SystemClock_Config(void);
 
 #ifdef __cplusplus
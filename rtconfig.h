@@ -36,6 +36,7 @@
 
 #define RT_USING_MEMPOOL
 #define RT_USING_SMALL_MEM
+#define RT_USING_MEMHEAP
 #define RT_USING_SMALL_MEM_AS_HEAP
 #define RT_USING_HEAP
 /* end of Memory Management */
@@ -469,9 +470,12 @@
 #define BSP_USING_GPIO
 #define BSP_USING_UART
 #define BSP_USING_UART1
+#define BSP_USING_ONCHIP_RTC
+#define BSP_RTC_USING_LSE
 #define BSP_USING_PWM
 #define BSP_USING_PWM14
 #define BSP_USING_PWM14_CH1
+#define BSP_USING_ON_CHIP_FLASH
 #define BSP_USING_SPI
 #define BSP_USING_SPI2
 #define BSP_USING_I2C
@@ -490,4 +494,12 @@
 /* end of Board extended module Drivers */
 /* end of Hardware Drivers Config */
 
+/* PhytoLink Application */
+
+#define LCD_USING_FRAMEBUFFER
+#define MBEDTLS_MEMORY_BUFFER_ALLOC_C
+#define MBEDTLS_PLATFORM_MEMORY
+#define MBEDTLS_MEMORY_DEBUG
+/* end of PhytoLink Application */
+
 #endif
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+异步日志解码工具：把设备以二进制模式（msh命令 dlog bin）输出的日志还原为文本
+
+帧格式（见applications/dlog.c）：
+  A5 5A [长度] [负载] [校验和]
+  负载：级别(1) 参数个数(1) 字符串掩码(1) 保留(1) tick(4) 格式字符串地址(4) 参数...
+  整数参数4字节小端，字符串参数为1字节长度+内容。
+格式字符串只以地址形式发送，本工具从ELF文件中按地址读出字符串（只用标准库解析ELF）。
+帧之外的字节（rt_kprintf输出、msh回显）按原样作为文本输出。
+
+用法：
+  python tools/dlog_decode.py rtthread.elf capture.bin
+  python tools/dlog_decode.py rtthread.elf /dev/ttyACM0      # 直接读取串口（需先设置波特率）
+  python tools/dlog_decode.py rtthread.elf - < capture.bin
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+LEVELS = ['E', 'W', 'I', 'D']
+HDR_SIZE = 12
+
+
+class ElfStrings:
+    """按虚拟地址读取ELF中的字符串常量（只支持32位小端ELF）"""
+
+    def __init__(self, path):
+        data = open(path, 'rb').read()
+        if data[:4] != b'\x7fELF' or data[4] != 1 or data[5] != 1:
+            raise ValueError('%s is not a 32-bit little-endian ELF' % path)
+        shoff, = struct.unpack_from('<I', data, 0x20)
+        shentsize, shnum = struct.unpack_from('<HH', data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, _, addr, offset, size = struct.unpack_from('<IIIIII', data, shoff + i * shentsize)
+            if sh_type == 1 and addr and size:      # SHT_PROGBITS，有加载地址
+                self.sections.append((addr, data[offset:offset + size]))
+        self.cache = {}
+
+    def string(self, addr):
+        if addr not in self.cache:
+            text = '<fmt@0x%08x>' % addr
+            for base, blob in self.sections:
+                if base <= addr < base + len(blob):
+                    end = blob.index(b'\0', addr - base)
+                    text = blob[addr - base:end].decode('utf-8', 'replace')
+                    break
+            self.cache[addr] = text
+        return self.cache[addr]
+
+
+def c_format(fmt, args):
+    """按C格式字符串格式化（只处理dlog支持的转换）"""
+    out, i = [], 0
+
+    def repl(m):
+        nonlocal i
+        spec = m.group(0)
+        if spec == '%%':
+            return '%'
+        conv = spec[-1]
+        flags = re.sub(r'[lhz]', '', spec[:-1])
+        if '*' in flags:
+            flags = flags.replace('*', str(args[i] if i < len(args) else 0))
+            i += 1
+        value = args[i] if i < len(args) else 0
+        i += 1
+        if conv == 's':
+            return (flags + 's') % value
+        if conv in 'di':
+            value = value - (1 << 32) if isinstance(value, int) and value & 0x80000000 else value
+            return (flags + 'd') % value
+        if conv == 'c':
+            return chr(value & 0xFF)
+        if conv == 'p':
+            return '0x%08x' % value
+        return (flags + conv) % value
+
+    return re.sub(r'%%|%[-+ #0-9.*lhz]*[a-zA-Z]', repl, fmt)
+
+
+def decode_payload(payload, elf):
+    level, nargs, mask, _, tick, fmt_addr = struct.unpack_from('<BBBBII', payload, 0)
+    args, pos = [], HDR_SIZE
+    for i in range(nargs):
+        if mask & (1 << i):
+            n = payload[pos]
+            args.append(payload[pos + 1:pos + 1 + n].decode('utf-8', 'replace'))
+            pos += 1 + n
+        else:
+            args.append(struct.unpack_from('<I', payload, pos)[0])
+            pos += 4
+    text = c_format(elf.string(fmt_addr), args)
+    return '[%10.3f] %s %s' % (tick / 1000.0, LEVELS[level] if level < len(LEVELS) else '?', text)
+
+
+def decode_stream(stream, elf, out):
+    """逐字节解析，帧之外的字节作为文本输出"""
+    buf = bytearray()
+    stats = {'frames': 0, 'bad': 0}
+    while True:
+        chunk = stream.read(1024)
+        if not chunk:
+            break
+        buf += chunk
+        while True:
+            idx = buf.find(b'\xa5\x5a')
+            if idx < 0:
+                keep = 1 if buf.endswith(b'\xa5') else 0
+                out.write(buf[:len(buf) - keep].decode('utf-8', 'replace'))
+                del buf[:len(buf) - keep]
+                break
+            if idx:
+                out.write(buf[:idx].decode('utf-8', 'replace'))
+                del buf[:idx]
+            if len(buf) < 3 or len(buf) < 3 + buf[2] + 1:
+                break
+            n = buf[2]
+            payload = bytes(buf[3:3 + n])
+            if n >= HDR_SIZE and sum(payload) & 0xFF == buf[3 + n]:
+                text = decode_payload(payload, elf)
+                out.write(text if text.endswith('\n') else text + '\n')
+                stats['frames'] += 1
+                del buf[:4 + n]
+            else:
+                stats['bad'] += 1
+                out.write(buf[:1].decode('latin-1'))
+                del buf[:1]
+        out.flush()
+    out.write(buf.decode('utf-8', 'replace'))
+    return stats
+
+
+def main():
+    parser = argparse.ArgumentParser(description='解码dlog二进制日志')
+    parser.add_argument('elf', help='与设备固件一致的rtthread.elf')
+    parser.add_argument('input', help='抓包文件、串口设备或-（标准输入）')
+    args = parser.parse_args()
+
+    elf = ElfStrings(args.elf)
+    stream = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb', buffering=0)
+    stats = decode_stream(stream, elf, sys.stdout)
+    sys.stderr.write('%d frames decoded, %d bad frames\n' % (stats['frames'], stats['bad']))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,269 @@
+/*
+ * 趋势图主机测试：用applications/lcd_chart.c和lcd_fb.c在内存帧缓冲中绘制，输出PPM图像
+ *
+ * 按设备上的节奏模拟：传感器线程每秒采样一次，显示线程每200ms绘制一帧。
+ *   1_awake     连续运行12分钟，曲线填满整个图
+ *   2_wake      屏幕休眠5分钟（照常采样、不绘制）后唤醒，新列一次画出，之后不再逐帧补列
+ *   3_outage    传感器停止采样3分钟，期间显示线程照常绘制，该段为空列
+ * 每一步都检查增量绘制（左移+新列）的结果与按历史数据整体重绘一致，以及右侧的最大/最小值刻度。
+ *
+ * 用法：tools/host/run.sh [输出目录]，PPM用任意看图软件打开（已放大4倍）。
+ */
+
+#include <rtthread.h>
+#include <drv_lcd.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lcd_chart.h"
+#include "lcd_fb.h"
+#include "lcd_glyph.h"
+#include "mem_region.h"
+
+#define FRAME_MS    200                 // 与main.c的DISPLAY_FRAME_MS一致
+#define SAMPLE_MS   1000                // 传感器采样间隔
+#define CHART_X     184                 // 与main.c的温度趋势图一致
+#define CHART_Y     121
+#define CHART_W     (LCD_W - CHART_X - LCD_CHART_LABEL_W)
+#define PPM_W       (LCD_W - CHART_X)   // 输出图像包含刻度
+#define CHART_H     22
+#define CHART_SPAN_MS (10 * 60 * 1000)
+#define SCALE       4                   // 输出图像放大倍数
+
+static rt_uint16_t framebuffer[LCD_W * LCD_H];
+static struct lcd_chart chart;
+static const char *out_dir = ".";
+
+/* lcd_fb.c依赖的其他模块：帧缓冲放在静态数组中，字形缓存用七段数码管式的图形代替字库 */
+void *mem_region_alloc(mem_hint_t hint, rt_size_t size)
+{
+    return size <= sizeof(framebuffer) ? framebuffer : RT_NULL;
+}
+
+void mem_region_free(void *ptr)
+{
+}
+
+rt_err_t lcd_glyph_render(char ch, rt_uint32_t size, rt_uint16_t back, rt_uint16_t fore,
+                          rt_uint16_t *dst, rt_uint16_t stride)
+{
+    return -RT_ENOSYS;
+}
+
+const rt_uint16_t *lcd_glyph_cached(char ch, rt_uint16_t back, rt_uint16_t fore)
+{
+    return RT_NULL;
+}
+
+/**
+ * 按七段数码管画出字符（2像素宽的笔画），k画成左竖线加右下斜段
+ */
+const rt_uint16_t *lcd_glyph_shape(char ch, rt_uint16_t *fore)
+{
+    /* 各字符点亮的段：bit0上 1右上 2右下 3下 4左下 5左上 6中 */
+    static const rt_uint8_t digits[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+    static const struct { rt_uint8_t x, y, w, h; } seg[7] = {
+        {2, 2, 8, 2}, {8, 2, 2, 11}, {8, 11, 2, 11}, {2, 20, 8, 2}, {2, 11, 2, 11}, {2, 2, 2, 11}, {2, 11, 8, 2},
+    };
+    static rt_uint16_t sprite[LCD_GLYPH_SIZE * LCD_GLYPH_W];
+    rt_uint8_t mask;
+    int s, r, c;
+
+    if (ch >= '0' && ch <= '9') {
+        mask = digits[ch - '0'];
+    } else if (ch == '-') {
+        mask = 0x40;
+    } else if (ch == 'k') {
+        mask = 0x74;  // 左上、左下、中、右下
+    } else {
+        return RT_NULL;
+    }
+
+    memset(sprite, 0, sizeof(sprite));
+    for (s = 0; s < 7; s++) {
+        if (!(mask & (1 << s))) {
+            continue;
+        }
+        for (r = seg[s].y; r < seg[s].y + seg[s].h; r++) {
+            for (c = seg[s].x; c < seg[s].x + seg[s].w; c++) {
+                sprite[r * LCD_GLYPH_W + c] = 1;
+            }
+        }
+    }
+    *fore = 1;
+    return sprite;
+}
+
+static float temperature(rt_tick_t t)
+{
+    return 25.0f + 10.0f * sinf(2.0f * 3.14159265f * t / (5 * 60 * 1000));
+}
+
+/**
+ * 推进ms毫秒，按需采样和绘制
+ *
+ * @return 有新列绘制的帧数
+ */
+static int run(rt_uint32_t ms, rt_bool_t sampling, rt_bool_t drawing)
+{
+    rt_tick_t end = rt_host_tick + rt_tick_from_millisecond(ms);
+    int drawn = 0;
+
+    while (rt_host_tick != end) {
+        rt_host_tick++;
+        if (sampling && rt_host_tick % SAMPLE_MS == 0) {
+            lcd_chart_sample(&chart, temperature(rt_host_tick));
+        }
+        if (drawing && rt_host_tick % FRAME_MS == 0) {
+            if (lcd_chart_draw(&chart)) {
+                drawn++;
+            }
+            if (lcd_fb_flush() != RT_EOK) {
+                printf("flush failed\n");
+                exit(1);
+            }
+        }
+    }
+
+    return drawn;
+}
+
+/**
+ * 检查增量绘制的结果与整体重绘一致
+ *
+ * 最左一列除外：增量绘制时它保留着连到已移出的那一列的竖线，重绘时只有一个点。
+ */
+static void check_redraw(const char *step)
+{
+    static rt_uint16_t saved[LCD_W * LCD_H];
+    int j;
+
+    memcpy(saved, framebuffer, sizeof(saved));
+    lcd_chart_redraw(&chart);
+    for (j = 0; j < CHART_H; j++) {
+        saved[(CHART_Y + j) * LCD_W + CHART_X] = framebuffer[(CHART_Y + j) * LCD_W + CHART_X];
+    }
+    if (memcmp(saved, framebuffer, sizeof(saved)) != 0) {
+        printf("%s: incremental drawing differs from redraw\n", step);
+        exit(1);
+    }
+}
+
+/**
+ * 统计图中只有背景色的列数
+ */
+static int empty_columns(void)
+{
+    int i, j, empty = 0;
+
+    for (i = 0; i < CHART_W; i++) {
+        for (j = 0; j < CHART_H; j++) {
+            if (framebuffer[(CHART_Y + j) * LCD_W + CHART_X + i] != WHITE) {
+                break;
+            }
+        }
+        empty += (j == CHART_H);
+    }
+
+    return empty;
+}
+
+/**
+ * 检查刻度文字与图中数据的范围一致，且刻度区域中画出了文字
+ */
+static void check_labels(const char *step, const char *hi, const char *lo)
+{
+    int i, j, ink = 0;
+
+    for (j = 0; j < CHART_H; j++) {
+        for (i = CHART_X + CHART_W; i < LCD_W; i++) {
+            ink += (framebuffer[(CHART_Y + j) * LCD_W + i] == RED);
+        }
+    }
+    printf("%s: labels max \"%s\" min \"%s\", %d label pixels\n", step, chart.label[0], chart.label[1], ink);
+    if (strcmp(chart.label[0], hi) != 0 || strcmp(chart.label[1], lo) != 0 || ink == 0) {
+        printf("%s: expected labels \"%s\" / \"%s\"\n", step, hi, lo);
+        exit(1);
+    }
+}
+
+/**
+ * 把趋势图区域（含刻度）放大SCALE倍写成二进制PPM(P6)
+ */
+static void write_ppm(const char *name)
+{
+    char path[256];
+    FILE *f;
+    int i, j;
+
+    snprintf(path, sizeof(path), "%s/chart_%s.ppm", out_dir, name);
+    f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        exit(1);
+    }
+
+    fprintf(f, "P6\n%d %d\n255\n", PPM_W * SCALE, CHART_H * SCALE);
+    for (j = 0; j < CHART_H * SCALE; j++) {
+        for (i = 0; i < PPM_W * SCALE; i++) {
+            rt_uint16_t c = framebuffer[(CHART_Y + j / SCALE) * LCD_W + CHART_X + i / SCALE];
+            /* RGB565展开为8位分量（与fb_ppm相同） */
+            fputc((c >> 11) * 255 / 31, f);
+            fputc(((c >> 5) & 0x3F) * 255 / 63, f);
+            fputc((c & 0x1F) * 255 / 31, f);
+        }
+    }
+    fclose(f);
+    printf("wrote %s\n", path);
+}
+
+int main(int argc, char **argv)
+{
+    int drawn;
+
+    if (argc > 1) {
+        out_dir = argv[1];
+    }
+
+    if (lcd_fb_init(WHITE) != RT_EOK) {
+        return 1;
+    }
+    rt_host_tick = 1;  // 设备上初始化趋势图时节拍已不为零
+    lcd_chart_init(&chart, CHART_X, CHART_Y, CHART_W, CHART_H, 10, 40, CHART_SPAN_MS, WHITE, RED);
+
+    /* 1. 连续运行：每个周期恰好画一列 */
+    drawn = run(12 * 60 * 1000, RT_TRUE, RT_TRUE);
+    printf("awake:  %d frames drew a column in 12 min, %d empty columns\n", drawn, empty_columns());
+    check_redraw("awake");
+    check_labels("awake", "35", "15");
+    write_ppm("1_awake");
+
+    /* 2. 休眠5分钟后唤醒：第一帧画出休眠期间的新列，之后10秒内不应再有新列 */
+    run(5 * 60 * 1000, RT_TRUE, RT_FALSE);
+    drawn = run(FRAME_MS, RT_TRUE, RT_TRUE);
+    printf("wake:   first frame drew %d time(s), ", drawn);
+    drawn = run(10 * 1000, RT_TRUE, RT_TRUE);
+    printf("%d more in the next 10 s\n", drawn);
+    if (drawn > 1) {
+        printf("wake: chart is catching up one column per frame\n");
+        return 1;
+    }
+    check_redraw("wake");
+    write_ppm("2_wake");
+
+    /* 3. 传感器停止采样3分钟：显示线程照常推进空列 */
+    run(3 * 60 * 1000, RT_FALSE, RT_TRUE);
+    run(2 * 60 * 1000, RT_TRUE, RT_TRUE);
+    printf("outage: %d empty columns\n", empty_columns());
+    if (empty_columns() < 3 * 60 * 1000 / (CHART_SPAN_MS / CHART_W) - 1) {
+        printf("outage: missing gap columns\n");
+        return 1;
+    }
+    check_redraw("outage");
+    check_labels("outage", "35", "15");
+    write_ppm("3_outage");
+
+    printf("flushed %u windows, %u pixels\n", lcd_host_windows, lcd_host_pixels);
+    return 0;
+}
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+用tools/dlog_decode.py解码dlog_frames输出的抓包，检查含0x0A字节的帧全部解出
+
+格式字符串不从ELF读取，而是用dlog_frames.fmt中的地址表代替。
+作为对照，把抓包按流模式串口的方式在每个0x0A前插入0x0D后再解码，应当出现坏帧，
+说明测试数据确实覆盖了会被流模式破坏的字节。
+
+用法：python tools/host/dlog_decode_check.py <dlog_frames的输出目录>
+"""
+
+import io
+import os
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+import dlog_decode  # noqa: E402
+
+EXPECTED = [
+    '[168430.090] I seq=10 age=168430090\n',  # tick 0x0A0A0A0A
+    '[     0.010] W ssid lab\nnet ch 6\n',
+]
+
+
+class FormatTable:
+    """按地址查格式字符串，接口与dlog_decode.ElfStrings相同"""
+
+    def __init__(self, path):
+        self.table = {}
+        with open(path) as f:
+            for line in f:
+                addr, fmt = line.rstrip('\n').split(' ', 1)
+                self.table[int(addr, 16)] = fmt.replace('\\n', '\n')
+
+    def string(self, addr):
+        return self.table.get(addr, '<fmt@0x%08x>' % addr)
+
+
+def decode(data, table):
+    out = io.StringIO()
+    stats = dlog_decode.decode_stream(io.BytesIO(data), table, out)
+    return stats, out.getvalue()
+
+
+def main():
+    root = sys.argv[1] if len(sys.argv) > 1 else '.'
+    table = FormatTable(os.path.join(root, 'dlog_frames.fmt'))
+    with open(os.path.join(root, 'dlog_frames.bin'), 'rb') as f:
+        data = f.read()
+
+    stats, text = decode(data, table)
+    print('raw capture:    %d frames, %d bad' % (stats['frames'], stats['bad']))
+    ok = stats == {'frames': 4, 'bad': 0} and text.startswith(''.join(EXPECTED))
+
+    stats, _ = decode(data.replace(b'\n', b'\r\n'), table)
+    print('stream capture: %d frames, %d bad' % (stats['frames'], stats['bad']))
+    ok = ok and stats['bad'] > 0 and stats['frames'] < 4
+
+    if not ok:
+        print('FAIL decoded text:\n' + text)
+        return 1
+    print('OK')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,62 @@
+/*
+ * 主机测试用的最小HAL接口
+ *
+ * DMA在调用HAL_DMA_Start_IT时立即完成并调用完成回调，用于走通lcd_fb的刷新流程，
+ * 不搬运数据（主机上帧缓冲地址放不进32位寄存器）。
+ */
+
+#ifndef __RT_HOST_BOARD_H__
+#define __RT_HOST_BOARD_H__
+
+#include <rtthread.h>
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT
+} HAL_StatusTypeDef;
+
+typedef struct {
+    volatile rt_uint32_t CTRL;
+    volatile rt_uint32_t CYCCNT;
+} DWT_Type;
+extern DWT_Type *DWT;
+extern rt_uint32_t SystemCoreClock;
+
+typedef struct {
+    rt_uint32_t Channel, Direction, PeriphInc, MemInc, PeriphDataAlignment, MemDataAlignment;
+    rt_uint32_t Mode, Priority, FIFOMode, FIFOThreshold, MemBurst, PeriphBurst;
+} DMA_InitTypeDef;
+
+typedef struct __DMA_HandleTypeDef {
+    void *Instance;
+    DMA_InitTypeDef Init;
+    void (*XferCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+    void (*XferErrorCallback)(struct __DMA_HandleTypeDef *hdma);
+} DMA_HandleTypeDef;
+
+#define DMA2_Stream0                RT_NULL
+#define DMA2_Stream0_IRQn           56
+#define DMA_CHANNEL_0               0
+#define DMA_MEMORY_TO_MEMORY        0
+#define DMA_PINC_ENABLE             0
+#define DMA_MINC_DISABLE            0
+#define DMA_PDATAALIGN_HALFWORD     0
+#define DMA_MDATAALIGN_HALFWORD     0
+#define DMA_NORMAL                  0
+#define DMA_PRIORITY_LOW            0
+#define DMA_FIFOMODE_ENABLE         0
+#define DMA_FIFO_THRESHOLD_FULL     0
+#define DMA_MBURST_SINGLE           0
+#define DMA_PBURST_SINGLE           0
+#define __HAL_RCC_DMA2_CLK_ENABLE() do {} while (0)
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, rt_uint32_t src, rt_uint32_t dst, rt_uint32_t count);
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+void HAL_NVIC_SetPriority(int irq, rt_uint32_t preempt, rt_uint32_t sub);
+void HAL_NVIC_EnableIRQ(int irq);
+
+#endif
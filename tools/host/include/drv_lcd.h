@@ -0,0 +1,25 @@
+/*
+ * 主机测试用的LCD驱动接口：只记录lcd_address_set设置的窗口
+ */
+
+#ifndef __RT_HOST_DRV_LCD_H__
+#define __RT_HOST_DRV_LCD_H__
+
+#include <rtthread.h>
+
+#define LCD_W       240
+#define LCD_H       240
+
+#define WHITE       0xFFFF
+#define BLACK       0x0000
+#define BLUE        0x001F
+#define RED         0xF800
+#define GREEN       0x07E0
+
+/* 累计写到屏幕的窗口数和像素数 */
+extern rt_uint32_t lcd_host_windows;
+extern rt_uint32_t lcd_host_pixels;
+
+void lcd_address_set(rt_uint16_t x1, rt_uint16_t y1, rt_uint16_t x2, rt_uint16_t y2);
+
+#endif
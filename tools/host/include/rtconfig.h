@@ -0,0 +1,10 @@
+/*
+ * 主机测试用的配置：只定义tools/host下各测试程序涉及的应用选项
+ */
+
+#ifndef __RT_HOST_RTCONFIG_H__
+#define __RT_HOST_RTCONFIG_H__
+
+#define LCD_USING_FRAMEBUFFER
+
+#endif /* __RT_HOST_RTCONFIG_H__ */
@@ -0,0 +1,158 @@
+/*
+ * 主机测试用的最小RT-Thread接口
+ *
+ * 只声明tools/host下各测试程序用到的部分，实现见rt_host.c。
+ * 时钟节拍由测试程序通过rt_host_tick直接推进，IPC对象在单线程下只做计数。
+ */
+
+#ifndef __RT_HOST_RTTHREAD_H__
+#define __RT_HOST_RTTHREAD_H__
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rtconfig.h"
+
+typedef int8_t      rt_int8_t;
+typedef int16_t     rt_int16_t;
+typedef int32_t     rt_int32_t;
+typedef int64_t     rt_int64_t;
+typedef uint8_t     rt_uint8_t;
+typedef uint16_t    rt_uint16_t;
+typedef uint32_t    rt_uint32_t;
+typedef uint64_t    rt_uint64_t;
+typedef int         rt_bool_t;
+typedef long        rt_base_t;
+typedef unsigned long rt_ubase_t;
+typedef rt_base_t   rt_err_t;
+typedef rt_uint32_t rt_tick_t;
+typedef rt_ubase_t  rt_size_t;
+
+#define RT_TRUE                 1
+#define RT_FALSE                0
+#define RT_NULL                 ((void *)0)
+
+#define RT_EOK                  0
+#define RT_ERROR                1
+#define RT_ETIMEOUT             2
+#define RT_EFULL                3
+#define RT_EEMPTY               4
+#define RT_ENOMEM               5
+#define RT_ENOSYS               6
+#define RT_EBUSY                7
+#define RT_EIO                  8
+#define RT_EINVAL               10
+
+#define RT_TICK_PER_SECOND      1000
+#define RT_TICK_MAX             0xFFFFFFFF
+#define RT_WAITING_FOREVER      -1
+#define RT_WAITING_NO           0
+#define RT_IPC_FLAG_FIFO        0x00
+#define RT_IPC_FLAG_PRIO        0x01
+#define RT_IPC_CMD_RESET        0x01
+#define RT_NAME_MAX             8
+#define RT_THREAD_PRIORITY_MAX  32
+#define RT_DEVICE_FLAG_RDWR     0x003
+#define RT_DEVICE_FLAG_STREAM   0x040
+#define RT_ALIGN_SIZE           4
+#define RT_ALIGN(size, align)   (((size) + (align) - 1) & ~((align) - 1))
+
+#define RT_ASSERT(EX)           assert(EX)
+#define rt_inline               static inline
+#define MSH_CMD_EXPORT(command, desc)
+#define INIT_APP_EXPORT(fn)
+
+struct rt_semaphore {
+    rt_uint32_t value;
+};
+typedef struct rt_semaphore *rt_sem_t;
+
+struct rt_mutex {
+    rt_uint32_t hold;
+};
+typedef struct rt_mutex *rt_mutex_t;
+
+struct rt_mempool {
+    void *start_address;            // 池内存起始地址
+    rt_size_t size;                 // 池内存大小
+    rt_size_t block_size;           // 块大小
+    rt_uint8_t *block_list;         // 空闲块链表
+    rt_size_t block_total_count;    // 块总数
+    rt_size_t block_free_count;     // 空闲块数
+};
+typedef struct rt_mempool *rt_mp_t;
+
+struct rt_thread {
+    void (*entry)(void *parameter);
+    void *parameter;
+};
+typedef struct rt_thread *rt_thread_t;
+
+struct rt_device {
+    rt_uint16_t open_flag;
+};
+typedef struct rt_device *rt_device_t;
+
+/* 测试程序推进的时钟节拍 */
+extern rt_tick_t rt_host_tick;
+
+rt_tick_t rt_tick_get(void);
+rt_tick_t rt_tick_from_millisecond(rt_int32_t ms);
+
+rt_base_t rt_hw_interrupt_disable(void);
+void rt_hw_interrupt_enable(rt_base_t level);
+void rt_enter_critical(void);
+void rt_exit_critical(void);
+void rt_interrupt_enter(void);
+void rt_interrupt_leave(void);
+
+/* 线程只创建不运行，需要时由测试程序直接调用入口函数 */
+rt_thread_t rt_thread_create(const char *name, void (*entry)(void *parameter), void *parameter,
+                             rt_uint32_t stack_size, rt_uint8_t priority, rt_uint32_t tick);
+rt_err_t rt_thread_startup(rt_thread_t thread);
+
+rt_err_t rt_sem_init(rt_sem_t sem, const char *name, rt_uint32_t value, rt_uint8_t flag);
+rt_err_t rt_sem_take(rt_sem_t sem, rt_int32_t timeout);
+rt_err_t rt_sem_release(rt_sem_t sem);
+rt_err_t rt_sem_control(rt_sem_t sem, int cmd, void *arg);
+rt_err_t rt_mutex_init(rt_mutex_t mutex, const char *name, rt_uint8_t flag);
+rt_err_t rt_mutex_take(rt_mutex_t mutex, rt_int32_t timeout);
+rt_err_t rt_mutex_release(rt_mutex_t mutex);
+
+rt_err_t rt_mp_init(struct rt_mempool *mp, const char *name, void *start, rt_size_t size, rt_size_t block_size);
+void *rt_mp_alloc(rt_mp_t mp, rt_int32_t time);
+void rt_mp_free(void *block);
+
+/* 系统堆：固定大小的首次适配堆，空闲块按地址合并，与small mem的碎片行为相近 */
+void *rt_malloc(rt_size_t size);
+void *rt_realloc(void *rmem, rt_size_t newsize);
+void *rt_calloc(rt_size_t count, rt_size_t size);
+void rt_free(void *rmem);
+void rt_memory_info(rt_size_t *total, rt_size_t *used, rt_size_t *max_used);
+rt_size_t rt_host_heap_largest(void);
+rt_bool_t rt_host_heap_owns(void *ptr);
+
+rt_size_t rt_strlen(const char *s);
+rt_int32_t rt_strcmp(const char *cs, const char *ct);
+char *rt_strdup(const char *s);     // 未实现：被引用时链接失败
+void *rt_memset(void *s, int c, rt_ubase_t count);
+void *rt_memcpy(void *dst, const void *src, rt_ubase_t count);
+void *rt_memmove(void *dest, const void *src, rt_ubase_t n);
+rt_int32_t rt_memcmp(const void *cs, const void *ct, rt_ubase_t count);
+void rt_kprintf(const char *fmt, ...);
+void rt_kputs(const char *str);
+int rt_snprintf(char *buf, rt_size_t size, const char *fmt, ...);
+int rt_vsnprintf(char *buf, rt_size_t size, const char *fmt, va_list args);
+
+/*
+ * 控制台设备：写入的字节追加到rt_host_console，
+ * 以流模式打开时与串口框架v1一样在每个0x0A前插入0x0D
+ */
+extern rt_uint8_t rt_host_console[4096];
+extern rt_size_t rt_host_console_len;
+rt_device_t rt_console_get_device(void);
+rt_size_t rt_device_write(rt_device_t dev, rt_base_t pos, const void *buffer, rt_size_t size);
+
+#endif
@@ -0,0 +1,142 @@
+/*
+ * 低功耗节拍补偿主机测试：applications/lowpower_tick.h的换算
+ *
+ *   basic      午夜回绕、锚点换算的舍入、多天后无漂移、节拍计数回绕（与msh lowpower check相同）
+ *   systick    WFI时长按SysTick计数换算，跨节拍、不同时钟档位
+ *   simulate   按lowpower_stop的做法模拟大量"运行-STOP"循环（跨越午夜），真实时间以微秒推进：
+ *              运行时节拍随SysTick增长，STOP时SysTick停止，醒来后按RTC（1/256秒）补偿节拍，
+ *              唤醒后恢复时钟的耗时随机。检查节拍与真实时间的误差始终有界、不随睡眠次数累积，
+ *              并与"每次加上计划睡眠时长"的做法对比。
+ *
+ * 用法：tools/host/run.sh
+ */
+
+#include <rtthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "lowpower_tick.h"
+
+#define SIM_CYCLES      100000          // 模拟的睡眠次数（约17天）
+#define SIM_MAX_ERR_MS  8               // 允许的最大误差：两个RTC单位
+
+static int failed = 0;
+
+#define CHECK(cond, msg) do { if (!(cond)) { printf("FAIL %s (line %d)\n", msg, __LINE__); failed++; } } while (0)
+
+static void test_basic(void)
+{
+    rt_uint64_t abs;
+    rt_uint32_t u;
+
+    /* 午夜回绕：23:59:59+200/256 到 00:00:00+10/256 经过66个单位 */
+    CHECK(lowpower_day_delta(86399UL * LP_RTC_SUBSEC + 200, 10) == 66, "day wrap");
+    CHECK(lowpower_day_delta(1000, 1000) == 0, "zero delta");
+
+    /* 任意时刻换算向下取整，误差小于一个节拍 */
+    for (u = 0; u < 4 * LP_RTC_SUBSEC; u++) {
+        rt_int32_t err = (rt_int32_t)(lowpower_expected_tick(0, 0, u) * LP_RTC_SUBSEC)
+                         - (rt_int32_t)(u * RT_TICK_PER_SECOND);
+        CHECK(err <= 0 && -err < LP_RTC_SUBSEC, "rounding");
+    }
+
+    /* 40天内整天的换算没有漂移 */
+    for (abs = 0; abs <= 40ULL * LP_RTC_DAY_UNITS; abs += LP_RTC_DAY_UNITS) {
+        CHECK(lowpower_expected_tick(5, 7, 7 + abs) == 5 + abs / LP_RTC_SUBSEC * RT_TICK_PER_SECOND, "drift");
+    }
+
+    /* 节拍计数回绕 */
+    CHECK(lowpower_expected_tick(0xFFFFFF00UL, 0, LP_RTC_SUBSEC) == (rt_tick_t)(0xFFFFFF00UL + RT_TICK_PER_SECOND),
+          "tick wrap");
+}
+
+static void test_systick(void)
+{
+    /* 168MHz：LOAD+1=168000，同一节拍内84000个周期为500us */
+    CHECK(lowpower_systick_us(0, 167999, 100000, 16000) == 500, "same tick");
+    /* 跨一个节拍：1000 + (168000 - 167000) = 2000个周期，约11.9us */
+    CHECK(lowpower_systick_us(1, 167999, 1000, 167000) == 11, "across a tick");
+    /* 同样的时长在42MHz（LOAD+1=42000）下换算结果相同 */
+    CHECK(lowpower_systick_us(3, 41999, 21000, 21000) == 3000, "low clock level");
+    CHECK(lowpower_systick_us(3, 167999, 84000, 84000) == 3000, "high clock level");
+}
+
+/**
+ * 简单的线性同余随机数，保证每次运行结果相同
+ */
+static rt_uint32_t sim_rand(rt_uint32_t range)
+{
+    static rt_uint64_t state = 0x2545F4914F6CDD1DULL;
+
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (rt_uint32_t)(state >> 33) % range;
+}
+
+static void test_simulate(void)
+{
+    rt_uint64_t t = 0;                  // 真实时间（微秒）
+    rt_uint64_t rtc_base = (86400ULL - 600) * LP_RTC_SUBSEC;  // 从23:50开始，十分钟后跨越午夜
+    rt_uint32_t frac = 0;               // 当前节拍内已经过的微秒
+    rt_tick_t tick = 0, naive = 0;      // 按RTC补偿的节拍、按计划时长累加的节拍
+    rt_uint32_t rtc_last = (rt_uint32_t)(rtc_base % LP_RTC_DAY_UNITS);
+    rt_uint64_t rtc_abs = 0, rtc_anchor = 0;
+    rt_tick_t tick_anchor = 0, expected;
+    rt_int64_t err, max_err = 0, naive_err = 0;
+    rt_uint32_t i, run_us, sleep_ms, raw, midnights = 0;
+
+    for (i = 0; i < SIM_CYCLES; i++) {
+        /* 运行一段时间：节拍由SysTick按真实时间推进 */
+        run_us = 200 + sim_rand(50000);
+        t += run_us;
+        frac += run_us;
+        tick += frac / 1000;
+        naive += frac / 1000;
+        frac %= 1000;
+
+        /* 睡前读RTC（一天内的1/256秒，展开回绕），首次睡眠时建立锚点 */
+        raw = (rt_uint32_t)((rtc_base + t * LP_RTC_SUBSEC / 1000000) % LP_RTC_DAY_UNITS);
+        midnights += raw < rtc_last;
+        rtc_abs += lowpower_day_delta(rtc_last, raw);
+        rtc_last = raw;
+        if (i == 0) {
+            rtc_anchor = rtc_abs;
+            tick_anchor = tick;
+        }
+
+        /* STOP：SysTick停止，唤醒后恢复时钟需要0.2~1.5ms */
+        sleep_ms = 10 + sim_rand(30000);
+        t += (rt_uint64_t)sleep_ms * 1000 + 200 + sim_rand(1300);
+        naive += sleep_ms;
+
+        raw = (rt_uint32_t)((rtc_base + t * LP_RTC_SUBSEC / 1000000) % LP_RTC_DAY_UNITS);
+        midnights += raw < rtc_last;
+        rtc_abs += lowpower_day_delta(rtc_last, raw);
+        rtc_last = raw;
+        expected = lowpower_expected_tick(tick_anchor, rtc_anchor, rtc_abs);
+        if ((rt_int32_t)(expected - tick) > 0) {
+            tick = expected;
+        }
+        frac = 0;  // 重新开启SysTick时VAL清零
+
+        err = (rt_int32_t)(tick - (rt_tick_t)(t / 1000));
+        if (err > max_err || -err > max_err) {
+            max_err = err > 0 ? err : -err;
+        }
+    }
+    naive_err = (rt_int32_t)(naive - (rt_tick_t)(t / 1000));
+
+    printf("simulate: %u sleeps over %.1f days, %u midnights: max |tick - real| %lld ms "
+           "(adding planned sleep instead: %lld ms behind)\n",
+           SIM_CYCLES, t / 86400e6, midnights, (long long)max_err, (long long)-naive_err);
+    CHECK(midnights > 0, "simulation did not cross midnight");
+    CHECK(max_err <= SIM_MAX_ERR_MS, "tick compensation error is not bounded");
+}
+
+int main(void)
+{
+    test_basic();
+    test_systick();
+    test_simulate();
+
+    printf("%s\n", failed ? "FAILED" : "OK");
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,426 @@
+/*
+ * 主机测试用的RT-Thread/HAL最小实现
+ *
+ * 测试程序都是单线程运行：关中断、调度锁、互斥锁只做嵌套检查，
+ * 信号量只计数，时钟节拍为rt_host_tick，由测试程序推进。
+ * 内存池与RT-Thread的块布局相同；系统堆是32KB的首次适配堆，用于观察碎片。
+ */
+
+#include <rtthread.h>
+#include <board.h>
+#include <drv_lcd.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+rt_tick_t rt_host_tick = 0;
+rt_uint32_t SystemCoreClock = 168000000;
+static DWT_Type host_dwt;
+DWT_Type *DWT = &host_dwt;
+
+rt_uint32_t lcd_host_windows = 0;
+rt_uint32_t lcd_host_pixels = 0;
+
+static int irq_nest = 0;  // 关中断嵌套层数
+
+rt_tick_t rt_tick_get(void)
+{
+    return rt_host_tick;
+}
+
+rt_tick_t rt_tick_from_millisecond(rt_int32_t ms)
+{
+    return (rt_tick_t)ms * RT_TICK_PER_SECOND / 1000;
+}
+
+rt_base_t rt_hw_interrupt_disable(void)
+{
+    return irq_nest++;
+}
+
+void rt_hw_interrupt_enable(rt_base_t level)
+{
+    irq_nest--;
+    RT_ASSERT(irq_nest == level);
+}
+
+void rt_enter_critical(void) {}
+void rt_exit_critical(void) {}
+void rt_interrupt_enter(void) {}
+void rt_interrupt_leave(void) {}
+
+rt_err_t rt_sem_init(rt_sem_t sem, const char *name, rt_uint32_t value, rt_uint8_t flag)
+{
+    sem->value = value;
+    return RT_EOK;
+}
+
+rt_err_t rt_sem_take(rt_sem_t sem, rt_int32_t timeout)
+{
+    /* 单线程下没有其他线程能释放信号量，取不到即视为超时 */
+    if (sem->value == 0) {
+        return -RT_ETIMEOUT;
+    }
+    sem->value--;
+    return RT_EOK;
+}
+
+rt_err_t rt_sem_release(rt_sem_t sem)
+{
+    sem->value++;
+    return RT_EOK;
+}
+
+rt_err_t rt_sem_control(rt_sem_t sem, int cmd, void *arg)
+{
+    if (cmd == RT_IPC_CMD_RESET) {
+        sem->value = (rt_uint32_t)(rt_ubase_t)arg;
+    }
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_init(rt_mutex_t mutex, const char *name, rt_uint8_t flag)
+{
+    mutex->hold = 0;
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_take(rt_mutex_t mutex, rt_int32_t timeout)
+{
+    mutex->hold++;
+    return RT_EOK;
+}
+
+rt_err_t rt_mutex_release(rt_mutex_t mutex)
+{
+    RT_ASSERT(mutex->hold > 0);
+    mutex->hold--;
+    return RT_EOK;
+}
+
+/*
+ * 内存池：与RT-Thread相同，每块前有一个指针，空闲时指向下一空闲块，分配后指向所属内存池
+ */
+rt_err_t rt_mp_init(struct rt_mempool *mp, const char *name, void *start, rt_size_t size, rt_size_t block_size)
+{
+    rt_size_t offset, i;
+    rt_uint8_t *block;
+
+    block_size = RT_ALIGN(block_size, RT_ALIGN_SIZE);
+    offset = block_size + sizeof(rt_uint8_t *);
+
+    mp->start_address = start;
+    mp->size = size;
+    mp->block_size = block_size;
+    mp->block_total_count = size / offset;
+    mp->block_free_count = mp->block_total_count;
+
+    for (i = 0; i < mp->block_total_count; i++) {
+        block = (rt_uint8_t *)start + i * offset;
+        *(rt_uint8_t **)block = (i + 1 < mp->block_total_count) ? block + offset : RT_NULL;
+    }
+    mp->block_list = mp->block_total_count ? start : RT_NULL;
+
+    return RT_EOK;
+}
+
+void *rt_mp_alloc(rt_mp_t mp, rt_int32_t time)
+{
+    rt_uint8_t *block;
+
+    /* 单线程下不会有其他线程归还，等待无意义 */
+    if (mp->block_free_count == 0) {
+        return RT_NULL;
+    }
+
+    block = mp->block_list;
+    mp->block_list = *(rt_uint8_t **)block;
+    *(rt_uint8_t **)block = (rt_uint8_t *)mp;
+    mp->block_free_count--;
+
+    return block + sizeof(rt_uint8_t *);
+}
+
+void rt_mp_free(void *ptr)
+{
+    rt_uint8_t *block = (rt_uint8_t *)ptr - sizeof(rt_uint8_t *);
+    rt_mp_t mp = *(rt_mp_t *)block;
+
+    RT_ASSERT(mp->block_free_count < mp->block_total_count);
+    *(rt_uint8_t **)block = mp->block_list;
+    mp->block_list = block;
+    mp->block_free_count++;
+}
+
+/*
+ * 系统堆：arena中按地址顺序排列的块，每块前有块头
+ */
+#define HOST_HEAP_SIZE      (32 * 1024)
+#define HOST_HEAP_MIN       16              // 拆分后剩余部分的最小可用字节数
+
+struct host_heap_item {
+    rt_size_t size;     // 可用字节数（不含块头）
+    rt_bool_t used;     // 是否已分配
+};
+
+static union {
+    struct host_heap_item align;
+    rt_uint8_t bytes[HOST_HEAP_SIZE];
+} host_heap;
+static rt_bool_t host_heap_ready = RT_FALSE;
+static rt_size_t host_heap_used = 0, host_heap_max = 0;
+
+#define HEAP_HDR            RT_ALIGN(sizeof(struct host_heap_item), RT_ALIGN_SIZE)
+#define HEAP_END            (host_heap.bytes + HOST_HEAP_SIZE)
+#define HEAP_NEXT(item)     ((struct host_heap_item *)((rt_uint8_t *)(item) + HEAP_HDR + (item)->size))
+
+static struct host_heap_item *host_heap_first(void)
+{
+    struct host_heap_item *item = (struct host_heap_item *)host_heap.bytes;
+
+    if (!host_heap_ready) {
+        item->size = HOST_HEAP_SIZE - HEAP_HDR;
+        item->used = RT_FALSE;
+        host_heap_ready = RT_TRUE;
+    }
+    return item;
+}
+
+void *rt_malloc(rt_size_t size)
+{
+    struct host_heap_item *item, *rest;
+
+    size = RT_ALIGN(size ? size : 1, RT_ALIGN_SIZE);
+    for (item = host_heap_first(); (rt_uint8_t *)item < HEAP_END; item = HEAP_NEXT(item)) {
+        if (item->used || item->size < size) {
+            continue;
+        }
+        if (item->size >= size + HEAP_HDR + HOST_HEAP_MIN) {
+            rest = (struct host_heap_item *)((rt_uint8_t *)item + HEAP_HDR + size);
+            rest->size = item->size - size - HEAP_HDR;
+            rest->used = RT_FALSE;
+            item->size = size;
+        }
+        item->used = RT_TRUE;
+        host_heap_used += item->size + HEAP_HDR;
+        if (host_heap_used > host_heap_max) {
+            host_heap_max = host_heap_used;
+        }
+        return (rt_uint8_t *)item + HEAP_HDR;
+    }
+
+    return RT_NULL;
+}
+
+void rt_free(void *rmem)
+{
+    struct host_heap_item *item, *next;
+
+    if (rmem == RT_NULL) {
+        return;
+    }
+
+    item = (struct host_heap_item *)((rt_uint8_t *)rmem - HEAP_HDR);
+    RT_ASSERT(rt_host_heap_owns(rmem) && item->used);
+    item->used = RT_FALSE;
+    host_heap_used -= item->size + HEAP_HDR;
+
+    /* 合并相邻的空闲块 */
+    for (item = host_heap_first(); (rt_uint8_t *)item < HEAP_END; item = HEAP_NEXT(item)) {
+        while (!item->used && (rt_uint8_t *)HEAP_NEXT(item) < HEAP_END && !HEAP_NEXT(item)->used) {
+            next = HEAP_NEXT(item);
+            item->size += HEAP_HDR + next->size;
+        }
+    }
+}
+
+void *rt_realloc(void *rmem, rt_size_t newsize)
+{
+    struct host_heap_item *item;
+    void *ptr;
+
+    if (rmem == RT_NULL) {
+        return rt_malloc(newsize);
+    }
+
+    item = (struct host_heap_item *)((rt_uint8_t *)rmem - HEAP_HDR);
+    if (newsize <= item->size) {
+        return rmem;
+    }
+    ptr = rt_malloc(newsize);
+    if (ptr != RT_NULL) {
+        memcpy(ptr, rmem, item->size);
+        rt_free(rmem);
+    }
+    return ptr;
+}
+
+void *rt_calloc(rt_size_t count, rt_size_t size)
+{
+    void *ptr = rt_malloc(count * size);
+
+    if (ptr != RT_NULL) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+void rt_memory_info(rt_size_t *total, rt_size_t *used, rt_size_t *max_used)
+{
+    *total = HOST_HEAP_SIZE;
+    *used = host_heap_used;
+    *max_used = host_heap_max;
+}
+
+/**
+ * 当前最大空闲块的可用字节数
+ */
+rt_size_t rt_host_heap_largest(void)
+{
+    struct host_heap_item *item;
+    rt_size_t largest = 0;
+
+    for (item = host_heap_first(); (rt_uint8_t *)item < HEAP_END; item = HEAP_NEXT(item)) {
+        if (!item->used && item->size > largest) {
+            largest = item->size;
+        }
+    }
+    return largest;
+}
+
+rt_bool_t rt_host_heap_owns(void *ptr)
+{
+    return (rt_uint8_t *)ptr >= host_heap.bytes && (rt_uint8_t *)ptr < HEAP_END;
+}
+
+rt_size_t rt_strlen(const char *s)
+{
+    return strlen(s);
+}
+
+rt_int32_t rt_strcmp(const char *cs, const char *ct)
+{
+    return strcmp(cs, ct);
+}
+
+void *rt_memset(void *s, int c, rt_ubase_t count)
+{
+    return memset(s, c, count);
+}
+
+void *rt_memcpy(void *dst, const void *src, rt_ubase_t count)
+{
+    return memcpy(dst, src, count);
+}
+
+void *rt_memmove(void *dest, const void *src, rt_ubase_t n)
+{
+    return memmove(dest, src, n);
+}
+
+rt_int32_t rt_memcmp(const void *cs, const void *ct, rt_ubase_t count)
+{
+    return memcmp(cs, ct, count);
+}
+
+void rt_kprintf(const char *fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+int rt_snprintf(char *buf, rt_size_t size, const char *fmt, ...)
+{
+    va_list args;
+    int n;
+
+    va_start(args, fmt);
+    n = vsnprintf(buf, size, fmt, args);
+    va_end(args);
+    return n;
+}
+
+void rt_kputs(const char *str)
+{
+    fputs(str, stdout);
+}
+
+int rt_vsnprintf(char *buf, rt_size_t size, const char *fmt, va_list args)
+{
+    return vsnprintf(buf, size, fmt, args);
+}
+
+rt_thread_t rt_thread_create(const char *name, void (*entry)(void *parameter), void *parameter,
+                             rt_uint32_t stack_size, rt_uint8_t priority, rt_uint32_t tick)
+{
+    rt_thread_t thread = malloc(sizeof(*thread));
+
+    if (thread != RT_NULL) {
+        thread->entry = entry;
+        thread->parameter = parameter;
+    }
+    return thread;
+}
+
+rt_err_t rt_thread_startup(rt_thread_t thread)
+{
+    return RT_EOK;
+}
+
+rt_uint8_t rt_host_console[4096];
+rt_size_t rt_host_console_len = 0;
+static struct rt_device host_console = { RT_DEVICE_FLAG_RDWR | RT_DEVICE_FLAG_STREAM };
+
+rt_device_t rt_console_get_device(void)
+{
+    return &host_console;
+}
+
+rt_size_t rt_device_write(rt_device_t dev, rt_base_t pos, const void *buffer, rt_size_t size)
+{
+    const rt_uint8_t *p = buffer;
+    rt_size_t i;
+
+    for (i = 0; i < size; i++) {
+        if (p[i] == '\n' && (dev->open_flag & RT_DEVICE_FLAG_STREAM)) {
+            assert(rt_host_console_len < sizeof(rt_host_console));
+            rt_host_console[rt_host_console_len++] = '\r';
+        }
+        assert(rt_host_console_len < sizeof(rt_host_console));
+        rt_host_console[rt_host_console_len++] = p[i];
+    }
+    return size;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, rt_uint32_t src, rt_uint32_t dst, rt_uint32_t count)
+{
+    /* 立即完成：完成回调可能继续启动下一行，递归深度不超过屏幕行数 */
+    if (hdma->XferCpltCallback != RT_NULL) {
+        hdma->XferCpltCallback(hdma);
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma)
+{
+    return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma) {}
+void HAL_NVIC_SetPriority(int irq, rt_uint32_t preempt, rt_uint32_t sub) {}
+void HAL_NVIC_EnableIRQ(int irq) {}
+
+void lcd_address_set(rt_uint16_t x1, rt_uint16_t y1, rt_uint16_t x2, rt_uint16_t y2)
+{
+    lcd_host_windows++;
+    lcd_host_pixels += (rt_uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1);
+}
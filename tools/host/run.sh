@@ -0,0 +1,37 @@
+#!/bin/sh
+# 编译并运行主机测试（需要gcc），用法：tools/host/run.sh [输出目录]
+set -e
+
+HOST=$(cd "$(dirname "$0")" && pwd)
+APP="$HOST/../../applications"
+OUT=${1:-.}
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+CC="${CC:-gcc} -std=gnu99 -O1 -g -Wall -Wno-unused-function -Wno-unused-variable -Wno-pointer-to-int-cast -I$HOST/include -I$APP"
+
+mkdir -p "$OUT"
+
+$CC -o "$BUILD/chart_ppm" "$HOST/chart_ppm.c" "$HOST/rt_host.c" \
+    "$APP/lcd_chart.c" "$APP/lcd_fb.c" "$APP/lcd_rle.c" -lm
+"$BUILD/chart_ppm" "$OUT"
+
+# webclient的编译单元按SConscript的参数强制包含web_pool.h，应引用web_pool_*而不是rt_malloc等
+$CC -DWEB_USING_POOL -include "$APP/web_pool.h" -c -o "$BUILD/webclient_redirect.o" "$HOST/webclient_redirect.c"
+echo "webclient_redirect.o undefined symbols:"
+nm -u "$BUILD/webclient_redirect.o" | sed 's/^/  /'
+if nm -u "$BUILD/webclient_redirect.o" | grep -Eq ' rt_(malloc|calloc|realloc|free|strdup)$'; then
+    echo "webclient allocations are not redirected to web_pool"
+    exit 1
+fi
+$CC -o "$BUILD/web_pool_soak" "$HOST/web_pool_soak.c" "$BUILD/webclient_redirect.o" \
+    "$HOST/rt_host.c" "$APP/web_pool.c"
+"$BUILD/web_pool_soak"
+
+$CC -o "$BUILD/lowpower_tick_check" "$HOST/lowpower_tick_check.c"
+"$BUILD/lowpower_tick_check"
+
+# dlog二进制帧经流模式控制台输出后仍能被tools/dlog_decode.py解码
+$CC -o "$BUILD/dlog_frames" "$HOST/dlog_frames.c" "$HOST/rt_host.c"
+"$BUILD/dlog_frames" "$OUT"
+${PYTHON:-python3} "$HOST/dlog_decode_check.py" "$OUT"
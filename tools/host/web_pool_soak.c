@@ -0,0 +1,165 @@
+/*
+ * webclient内存池主机测试：applications/web_pool.c在主机内存池/系统堆实现上运行
+ *
+ *   redirect   按webclient的方式分配的内存来自内存池而不是系统堆
+ *   classes    尺寸档选择、用尽后退回系统堆、realloc原地/换档、超大分配
+ *   soak       按设备上web_soak的分配顺序循环，对比heap和pool两种方式下
+ *              系统堆的用量和最大空闲块（32KB首次适配堆，其它模块的长期小块穿插其中）
+ *
+ * 用法：tools/host/run.sh（先用nm检查webclient_redirect.o的符号，再运行本程序）
+ */
+
+#include <rtthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem_region.h"
+#include "web_pool.h"
+
+#define SOAK_ROUNDS     20000
+#define KEEP_BLOCKS     16              // 与web_soak一致：长期持有的小块数
+
+void *webclient_probe_malloc(rt_size_t size);
+void *webclient_probe_realloc(void *ptr, rt_size_t size);
+char *webclient_probe_strdup(const char *s);
+void webclient_probe_free(void *ptr);
+
+static int failed = 0;
+
+#define CHECK(cond, msg) do { if (!(cond)) { printf("FAIL %s (line %d)\n", msg, __LINE__); failed++; } } while (0)
+
+/* 池内存在设备上来自CCM，与系统堆分开；主机上直接用libc */
+void *mem_region_alloc(mem_hint_t hint, rt_size_t size)
+{
+    return malloc(size);
+}
+
+static void test_redirect(void)
+{
+    void *ptr;
+    char *str;
+
+    ptr = webclient_probe_malloc(48);
+    CHECK(ptr != RT_NULL && !rt_host_heap_owns(ptr), "web_malloc is not served from the pool");
+    ptr = webclient_probe_realloc(ptr, 200);
+    CHECK(ptr != RT_NULL && !rt_host_heap_owns(ptr), "web_realloc is not served from the pool");
+    webclient_probe_free(ptr);
+
+    str = webclient_probe_strdup("192.168.1.100");
+    CHECK(str != RT_NULL && !rt_host_heap_owns(str) && strcmp(str, "192.168.1.100") == 0,
+          "web_strdup is not served from the pool");
+    webclient_probe_free(str);
+}
+
+static void test_classes(void)
+{
+    void *small[9];
+    rt_size_t total, used, max_used;
+    char *ptr, *moved;
+    int i;
+
+    /* 64字节档8块，第9块退回系统堆 */
+    for (i = 0; i < 9; i++) {
+        small[i] = web_pool_malloc(64);
+        CHECK(small[i] != RT_NULL, "64-byte allocation failed");
+    }
+    for (i = 0; i < 8; i++) {
+        CHECK(!rt_host_heap_owns(small[i]), "64-byte class served from heap");
+    }
+    CHECK(rt_host_heap_owns(small[8]), "exhausted class did not fall back to heap");
+    for (i = 0; i < 9; i++) {
+        web_pool_free(small[i]);
+    }
+
+    /* 不超过原档原地返回，超过时换到更大的档并保留内容 */
+    ptr = web_pool_malloc(40);
+    memset(ptr, 0x5A, 40);
+    CHECK(web_pool_realloc(ptr, 60) == ptr, "realloc within class moved");
+    moved = web_pool_realloc(ptr, 200);
+    CHECK(moved != RT_NULL && moved != ptr && !rt_host_heap_owns(moved), "realloc to 256-byte class");
+    for (i = 0; i < 40; i++) {
+        CHECK(moved[i] == 0x5A, "realloc lost data");
+    }
+    web_pool_free(moved);
+
+    /* 超过最大档直接走系统堆 */
+    ptr = web_pool_malloc(2000);
+    CHECK(ptr != RT_NULL && rt_host_heap_owns(ptr), "oversize allocation not from heap");
+    web_pool_free(ptr);
+
+    rt_memory_info(&total, &used, &max_used);
+    CHECK(used == 0, "heap not empty after class tests");
+}
+
+/**
+ * 按web_soak的顺序分配/释放，返回过程中系统堆最大空闲块的最低值
+ */
+static rt_size_t soak(const char *mode, void *(*alloc)(size_t), void (*release)(void *))
+{
+    void *session, *header, *buffer, *host, *url;
+    void *keep[KEEP_BLOCKS] = {RT_NULL};
+    rt_size_t total, used, max_used, largest, lowest = (rt_size_t)-1;
+    int keep_idx = 0, i;
+
+    printf("%-5s %8s %8s %12s\n", mode, "round", "used", "largest free");
+    for (i = 1; i <= SOAK_ROUNDS; i++) {
+        session = alloc(48);
+        header = alloc(12);
+        buffer = alloc(1024);
+        host = alloc(16);
+        url = alloc(150 + i % 40);
+        CHECK(session && header && buffer && host && url, "soak allocation failed");
+
+        if (i % 50 == 0) {
+            rt_free(keep[keep_idx]);
+            keep[keep_idx] = rt_malloc(24 + i % 64);
+            keep_idx = (keep_idx + 1) % KEEP_BLOCKS;
+        }
+
+        largest = rt_host_heap_largest();
+        if (largest < lowest) {
+            lowest = largest;
+        }
+
+        release(url);
+        release(host);
+        release(buffer);
+        release(header);
+        release(session);
+
+        if (i % (SOAK_ROUNDS / 5) == 0) {
+            rt_memory_info(&total, &used, &max_used);
+            printf("%-5s %8d %8lu %12lu\n", "", i, (unsigned long)used, (unsigned long)rt_host_heap_largest());
+        }
+    }
+
+    for (i = 0; i < KEEP_BLOCKS; i++) {
+        rt_free(keep[i]);
+    }
+    rt_memory_info(&total, &used, &max_used);
+    CHECK(used == 0, "soak leaked heap memory");
+
+    return lowest;
+}
+
+int main(void)
+{
+    rt_size_t heap_low, pool_low;
+
+    if (web_pool_init() != RT_EOK) {
+        printf("web_pool_init failed\n");
+        return 1;
+    }
+
+    test_redirect();
+    test_classes();
+
+    heap_low = soak("heap", rt_malloc, rt_free);
+    pool_low = soak("pool", web_pool_malloc, web_pool_free);
+    printf("lowest largest-free block while a request is in flight: heap %lu, pool %lu\n",
+           (unsigned long)heap_low, (unsigned long)pool_low);
+    CHECK(pool_low >= heap_low, "pool mode fragments the heap more than heap mode");
+
+    printf("%s\n", failed ? "FAILED" : "OK");
+    return failed ? 1 : 0;
+}
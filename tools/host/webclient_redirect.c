@@ -0,0 +1,50 @@
+/*
+ * 模拟webclient软件包中使用web_malloc等的编译单元
+ *
+ * webclient-v2.2.0的inc/webclient.h只在web_malloc等未定义时才把它们定义为rt_malloc等，
+ * 这里照抄这段默认定义。run.sh用applications/SConscript给出的同样参数
+ * （-DWEB_USING_POOL -include web_pool.h）编译本文件，再用nm检查目标文件
+ * 引用的是web_pool_*而不是rt_malloc/rt_free；web_pool_soak在运行时再确认一次。
+ */
+
+#include <rtthread.h>
+
+#ifndef web_malloc
+#define web_malloc                     rt_malloc
+#endif
+
+#ifndef web_calloc
+#define web_calloc                     rt_calloc
+#endif
+
+#ifndef web_realloc
+#define web_realloc                    rt_realloc
+#endif
+
+#ifndef web_free
+#define web_free                       rt_free
+#endif
+
+#ifndef web_strdup
+#define web_strdup                     rt_strdup
+#endif
+
+void *webclient_probe_malloc(rt_size_t size)
+{
+    return web_malloc(size);
+}
+
+void *webclient_probe_realloc(void *ptr, rt_size_t size)
+{
+    return web_realloc(ptr, size);
+}
+
+char *webclient_probe_strdup(const char *s)
+{
+    return web_strdup(s);
+}
+
+void webclient_probe_free(void *ptr)
+{
+    web_free(ptr);
+}
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+图片资源转换工具：把RGB565图片编码为逐行RLE格式的C头文件
+
+输入可以是：
+  - 原始C数组头文件（如lcd_show_image使用的数组，RGB565高字节在前）
+  - 本工具生成的RLE头文件（可重新导出为BMP编辑）
+  - 24位BMP文件（无需第三方库）
+输出文件名以.bmp结尾时导出为24位BMP，否则生成RLE头文件。
+
+编码格式（每行独立编码，解码时逐行写入LCD窗口，只需一行的缓冲区）：
+  控制字节c:
+    c & 0x80 为1：重复段，后跟1个像素（2字节，高字节在前），重复 (c & 0x7F) + 1 次
+    c & 0x80 为0：原样段，后跟 (c + 1) 个像素
+  所有行依次拼接，行与行之间没有分隔（解码器按宽度计数）。
+
+用法：
+  python tools/img2rle.py logo.bmp --name image_rttlogo -o applications/rttlogo.h
+  python tools/img2rle.py applications/rttlogo.h -o logo.bmp
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+MAX_RUN = 128  # 单个段最多像素数
+
+
+def load_c_array(path):
+    """从C数组头文件中读取字节"""
+    text = open(path, encoding='utf-8', errors='ignore').read()
+    body = text[text.index('{') + 1:text.rindex('}')]
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+    data = bytes(int(v, 16) for v in re.findall(r'0[xX][0-9a-fA-F]{1,2}', body))
+    return [(data[2 * i] << 8) | data[2 * i + 1] for i in range(len(data) // 2)]
+
+
+def load_rle_header(text):
+    """从本工具生成的头文件中读取宽高并解码"""
+    width, height = map(int, re.search(r'lcd_rle_image\s+\w+\s*=\s*\{\s*(\d+),\s*(\d+)', text).groups())
+    body = text[text.index('{') + 1:text.index('}')]
+    data = bytes(int(v, 16) for v in re.findall(r'0[xX][0-9a-fA-F]{1,2}', body))
+    return width, height, decode(data, width, height)
+
+
+def save_bmp(path, width, height, pixels):
+    """保存为24位BMP"""
+    stride = (width * 3 + 3) & ~3
+    size = 54 + stride * height
+    out = bytearray(b'BM' + struct.pack('<IHHI', size, 0, 0, 54))
+    out += struct.pack('<IiiHHIIiiII', 40, width, height, 1, 24, 0, stride * height, 2835, 2835, 0, 0)
+    for row in range(height - 1, -1, -1):
+        line = bytearray()
+        for p in pixels[row * width:(row + 1) * width]:
+            r, g, b = (p >> 11) & 0x1F, (p >> 5) & 0x3F, p & 0x1F
+            line += bytes(((b << 3) | (b >> 2), (g << 2) | (g >> 4), (r << 3) | (r >> 2)))
+        out += line + bytes(stride - len(line))
+    open(path, 'wb').write(out)
+
+
+def load_bmp(path):
+    """读取24位无压缩BMP，返回(宽, 高, RGB565像素列表)"""
+    raw = open(path, 'rb').read()
+    offset, = struct.unpack_from('<I', raw, 10)
+    width, height, _, bpp, compression = struct.unpack_from('<iiHHI', raw, 18)
+    if bpp != 24 or compression != 0:
+        sys.exit('only uncompressed 24-bit BMP is supported')
+    stride = (width * 3 + 3) & ~3
+    pixels = []
+    for row in range(abs(height)):
+        src = row if height < 0 else abs(height) - 1 - row  # BMP默认自下而上存储
+        base = offset + src * stride
+        for x in range(width):
+            b, g, r = raw[base + 3 * x:base + 3 * x + 3]
+            pixels.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return width, abs(height), pixels
+
+
+def encode_row(row):
+    """编码一行像素"""
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend((p >> 8, p & 0xFF))
+
+    i = 0
+    while i < len(row):
+        run = 1
+        while i + run < len(row) and row[i + run] == row[i] and run < MAX_RUN:
+            run += 1
+        if run >= 2:
+            # 两个相同像素用重复段（3字节）已不比原样段（4字节）长
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out += bytes((row[i] >> 8, row[i] & 0xFF))
+        else:
+            literal.append(row[i])
+        i += run
+    flush_literal()
+    return out
+
+
+def decode(data, width, height):
+    """解码，用于校验编码结果"""
+    pixels = []
+    pos = 0
+    for _ in range(height):
+        row = []
+        while len(row) < width:
+            c = data[pos]
+            pos += 1
+            if c & 0x80:
+                p = (data[pos] << 8) | data[pos + 1]
+                pos += 2
+                row += [p] * ((c & 0x7F) + 1)
+            else:
+                for _ in range(c + 1):
+                    row.append((data[pos] << 8) | data[pos + 1])
+                    pos += 2
+        pixels += row
+    return pixels
+
+
+def main():
+    parser = argparse.ArgumentParser(description='convert an RGB565 image to a row-RLE C header')
+    parser.add_argument('input', help='C array header or 24-bit BMP')
+    parser.add_argument('--width', type=int, help='image width (C array input)')
+    parser.add_argument('--height', type=int, help='image height (C array input)')
+    parser.add_argument('--name', default='image', help='C symbol name')
+    parser.add_argument('-o', '--output', required=True, help='output header')
+    args = parser.parse_args()
+
+    if args.input.lower().endswith('.bmp'):
+        width, height, pixels = load_bmp(args.input)
+    elif 'lcd_rle_image' in open(args.input, encoding='utf-8', errors='ignore').read():
+        width, height, pixels = load_rle_header(open(args.input, encoding='utf-8').read())
+    else:
+        if not args.width or not args.height:
+            sys.exit('--width and --height are required for C array input')
+        width, height = args.width, args.height
+        pixels = load_c_array(args.input)
+    if len(pixels) != width * height:
+        sys.exit('pixel count %d does not match %dx%d' % (len(pixels), width, height))
+
+    if args.output.lower().endswith('.bmp'):
+        save_bmp(args.output, width, height, pixels)
+        print('%dx%d written to %s' % (width, height, args.output))
+        return
+
+    data = bytearray()
+    for y in range(height):
+        data += encode_row(pixels[y * width:(y + 1) * width])
+    assert decode(data, width, height) == pixels
+
+    raw_size = width * height * 2
+    guard = '__%s_H__' % args.name.upper()
+    with open(args.output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('/*\n * 由tools/img2rle.py生成，请勿手动修改\n')
+        f.write(' * %dx%d RGB565，逐行RLE编码：%d字节（原始%d字节，%.1f%%）\n */\n\n'
+                % (width, height, len(data), raw_size, len(data) * 100.0 / raw_size))
+        f.write('#ifndef %s\n#define %s\n\n#include "lcd_rle.h"\n\n' % (guard, guard))
+        f.write('static const rt_uint8_t %s_data[] = {\n' % args.name)
+        for i in range(0, len(data), 16):
+            f.write(''.join('0X%02X,' % b for b in data[i:i + 16]) + '\n')
+        f.write('};\n\n')
+        f.write('static const struct lcd_rle_image %s = {\n' % args.name)
+        f.write('    %d, %d, %s_data, sizeof(%s_data)\n};\n\n' % (width, height, args.name, args.name))
+        f.write('#endif\n')
+
+    print('%dx%d: %d -> %d bytes (saved %d bytes, %.1f%%)'
+          % (width, height, raw_size, len(data), raw_size - len(data), 100 - len(data) * 100.0 / raw_size))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+线程栈大小分析工具：汇总编译期栈用量和运行期栈水位，给出每个线程的推荐栈大小
+
+编译期：rtconfig.py（scons）和.cproject（RT-Thread Studio）都为gcc打开了-fstack-usage，
+每个.o旁边会生成.su文件（每个函数的栈帧大小）。
+本工具用objdump反汇编ELF得到调用关系，从每个线程入口函数出发求最深调用链的栈帧之和，
+再加上异常/上下文切换保存在线程栈上的寄存器（含FPU时约208字节）。
+通过函数指针的调用（blx寄存器）和递归无法静态确定，会在报告中标出。
+
+运行期：在设备上长时间运行后执行msh命令stack_wm，把输出保存到文件，用--runtime传入。
+
+线程列表从applications/*.c中的rt_thread_create调用解析（入口函数和当前栈大小），
+main线程的栈大小来自rtconfig.h的RT_MAIN_THREAD_STACK_SIZE。
+
+用法：
+  scons
+  python tools/stack_report.py --elf rtthread.elf --su-dir build
+  python tools/stack_report.py --elf rtthread.elf --su-dir build --runtime stack_wm.log --margin 25
+  python tools/stack_report.py --elf Debug/rtthread.elf --su-dir Debug    # RT-Thread Studio构建
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+CONTEXT_BYTES = 208     # 硬件异常帧（含FPU 104字节）+ 上下文切换保存的r4-r11/s16-s31
+ALIGN = 128             # 推荐值对齐粒度
+NAME_MAX = 8            # 与rtconfig.h的RT_NAME_MAX一致（含结尾'\0'）
+
+
+def load_su(su_dir):
+    """读取所有.su文件，返回{函数名: 栈帧字节数}和动态栈帧的函数集合"""
+    frames, dynamic = {}, set()
+    for root, _, files in os.walk(su_dir):
+        for name in files:
+            if not name.endswith('.su'):
+                continue
+            for line in open(os.path.join(root, name), encoding='utf-8', errors='ignore'):
+                parts = line.rstrip('\n').split('\t')
+                if len(parts) < 3:
+                    continue
+                func = parts[0].split(':')[-1]
+                frames[func] = max(frames.get(func, 0), int(parts[1]))
+                if 'dynamic' in parts[2]:
+                    dynamic.add(func)
+    return frames, dynamic
+
+
+def load_callgraph(elf, objdump):
+    """反汇编ELF，返回{函数名: 被调用函数集合}和含间接调用的函数集合"""
+    out = subprocess.run([objdump, '-d', '--no-show-raw-insn', elf],
+                         stdout=subprocess.PIPE, universal_newlines=True, check=True).stdout
+    calls, indirect = {}, set()
+    func = None
+    for line in out.splitlines():
+        m = re.match(r'^[0-9a-f]+ <([^>]+)>:$', line)
+        if m:
+            func = m.group(1)
+            calls.setdefault(func, set())
+            continue
+        if func is None:
+            continue
+        m = re.search(r'\s(bl|blx|b\.w|b)\s+[0-9a-f]+ <([^>+]+)>', line)
+        if m and m.group(2) != func:
+            calls[func].add(m.group(2))   # 尾调用（b.w到其它函数）也按调用处理
+        elif re.search(r'\sblx\s+r\d+', line):
+            indirect.add(func)
+    return calls, indirect
+
+
+def worst_depth(entry, frames, calls):
+    """求从entry出发的最深调用链，返回(字节数, 调用链, 缺少.su的函数, 是否有递归)"""
+    memo, missing = {}, set()
+    recursive = [False]
+
+    def visit(func, stack):
+        if func in memo:
+            return memo[func]
+        if func in stack:
+            recursive[0] = True
+            return 0, []
+        if func not in frames:
+            missing.add(func)
+        stack.add(func)
+        best, best_chain = 0, []
+        for callee in calls.get(func, ()):
+            depth, chain = visit(callee, stack)
+            if depth > best:
+                best, best_chain = depth, chain
+        stack.discard(func)
+        memo[func] = (frames.get(func, 0) + best, [func] + best_chain)
+        return memo[func]
+
+    depth, chain = visit(entry, set())
+    return depth, chain, missing, recursive[0]
+
+
+def resolve(value, defines):
+    """把宏名或表达式替换为数值"""
+    value = re.sub(r'//.*', '', value).strip()
+    for _ in range(4):
+        value = re.sub(r'\b[A-Z_][A-Z0-9_]*\b', lambda m: defines.get(m.group(0), m.group(0)), value)
+    try:
+        return int(eval(value, {}, {}))
+    except Exception:
+        return None
+
+
+def load_threads(app_dir, rtconfig):
+    """从源码解析线程名、入口函数和栈大小"""
+    defines = {}
+    for line in open(rtconfig, encoding='utf-8', errors='ignore'):
+        m = re.match(r'#define\s+(\w+)\s+(\S+)', line)
+        if m:
+            defines[m.group(1)] = m.group(2)
+
+    threads = [{'name': 'main', 'entry': 'main_thread_entry',
+                'size': resolve('RT_MAIN_THREAD_STACK_SIZE', defines), 'src': 'rtconfig.h'}]
+    for name in sorted(os.listdir(app_dir)):
+        if not name.endswith('.c'):
+            continue
+        text = open(os.path.join(app_dir, name), encoding='utf-8', errors='ignore').read()
+        local = dict(defines)
+        for m in re.finditer(r'#define\s+(\w+)\s+([^\n]+)', text):
+            local[m.group(1)] = re.sub(r'//.*|/\*.*', '', m.group(2)).strip()
+        for m in re.finditer(r'rt_thread_create\s*\(\s*"([^"]+)"\s*,\s*(\w+)\s*,\s*[^,]+,\s*([^,]+),', text):
+            threads.append({'name': m.group(1), 'entry': m.group(2),
+                            'size': resolve(m.group(3), local), 'src': name})
+    return threads
+
+
+def load_runtime(path):
+    """读取msh命令stack_wm的输出，返回{线程名: 最大使用量}"""
+    used = {}
+    for line in open(path, encoding='utf-8', errors='ignore'):
+        m = re.match(r'^(\S+)\s+(\d+)\s+(\d+)\s+\d+%', line.strip())
+        if m:
+            used[m.group(1)] = max(used.get(m.group(1), 0), int(m.group(3)))
+    return used
+
+
+def main():
+    parser = argparse.ArgumentParser(description='线程栈大小分析报告')
+    parser.add_argument('--elf', help='rtthread.elf（需要-fstack-usage编译）')
+    parser.add_argument('--su-dir', default='build', help='.su文件所在目录')
+    parser.add_argument('--objdump', default='arm-none-eabi-objdump')
+    parser.add_argument('--runtime', help='stack_wm命令的输出日志')
+    parser.add_argument('--margin', type=int, default=25, help='余量百分比')
+    parser.add_argument('--app-dir', default='applications')
+    parser.add_argument('--rtconfig', default='rtconfig.h')
+    args = parser.parse_args()
+
+    threads = load_threads(args.app_dir, args.rtconfig)
+    frames, dynamic, calls, indirect = {}, set(), {}, set()
+    if args.elf:
+        frames, dynamic = load_su(args.su_dir)
+        if not frames:
+            sys.exit('no .su files under %s, rebuild with -fstack-usage' % args.su_dir)
+        calls, indirect = load_callgraph(args.elf, args.objdump)
+    runtime = load_runtime(args.runtime) if args.runtime else {}
+
+    print('%-12s %-28s %6s %7s %7s %9s %6s  %s' % ('thread', 'entry', 'size', 'static', 'runtime',
+                                                 'recommend', 'delta', 'notes'))
+    saved = 0
+    for t in threads:
+        notes = []
+        static = None
+        if args.elf:
+            depth, chain, missing, recursive = worst_depth(t['entry'], frames, calls)
+            static = depth + CONTEXT_BYTES
+            if recursive:
+                notes.append('recursion')
+            if any(f in indirect for f in chain) or t['entry'] in indirect:
+                notes.append('indirect calls')
+            if any(f in dynamic for f in chain):
+                notes.append('dynamic frame')
+            if missing:
+                notes.append('%d funcs without .su' % len(missing))
+        measured = runtime.get(t['name'][:NAME_MAX - 1])
+        base = max(v for v in (static, measured, 0) if v is not None)
+        recommend = (base * (100 + args.margin) // 100 + ALIGN - 1) // ALIGN * ALIGN if base else None
+        delta = ''
+        if recommend and t['size']:
+            delta = '%+d' % (recommend - t['size'])
+            saved += t['size'] - recommend
+        print('%-12s %-28s %6s %7s %7s %9s %6s  %s' % (
+            t['name'], t['entry'], t['size'] or '?', static if static is not None else '-',
+            measured if measured is not None else '-', recommend or '-', delta, ', '.join(notes)))
+
+    print('\ntotal change if applied: %+d bytes' % -saved)
+    print('static = deepest call chain from .su frames + %d bytes context; '
+          'recommend = max(static, runtime) + %d%%, rounded to %d' % (CONTEXT_BYTES, args.margin, ALIGN))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+事件跟踪转换工具：把从RTT通道0抓取的二进制事件流转换为Chrome trace JSON，
+可在 chrome://tracing 或 https://ui.perfetto.dev 中打开。
+
+事件格式（见applications/trace.h）：
+  类型(1) 编号(1) 附加值(2) 时间戳(4，微秒，约71分钟回绕)，小端
+  名称定义事件后跟16字节名称。
+
+抓取方法（设备上先执行msh命令 trace start）：
+  JLinkRTTLogger -Device STM32F407ZG -If SWD -Speed 4000 -RTTChannel 0 capture.bin
+  或 OpenOCD: rtt setup 0x20000000 0x20000 "SEGGER RTT"; rtt start; rtt server start 9090 0
+              再用 nc localhost 9090 > capture.bin
+
+输出分三组轨道：
+  Scheduler  每个线程的运行区间，以及中断轨道
+  Stages     每个线程内的流水线阶段（perf.h）和等待互斥锁的区间
+  Locks      每个互斥锁被哪个线程持有
+
+用法：
+  python tools/trace2json.py capture.bin -o trace.json
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+EVT_NAME = 1
+EVT_SWITCH = 2
+EVT_ISR_ENTER = 3
+EVT_ISR_EXIT = 4
+EVT_STAGE_BEGIN = 5
+EVT_STAGE_END = 6
+EVT_MUTEX_WAIT = 7
+EVT_MUTEX_TAKE = 8
+EVT_MUTEX_RELEASE = 9
+EVT_OVERFLOW = 10
+
+NAME_THREAD = 0
+NAME_MUTEX = 1
+NAME_STAGE = 2
+NAME_LEN = 16
+
+PID_SCHED = 1
+PID_STAGES = 2
+PID_LOCKS = 3
+TID_ISR = 1000
+
+
+def read_events(data):
+    """逐个解析事件，返回 (类型, 编号, 附加值, 时间戳, 名称)"""
+    pos = 0
+    while pos + 8 <= len(data):
+        evt, ident, aux, stamp = struct.unpack_from('<BBHI', data, pos)
+        pos += 8
+        name = None
+        if evt == EVT_NAME:
+            if pos + NAME_LEN > len(data):
+                break
+            name = data[pos:pos + NAME_LEN].split(b'\0', 1)[0].decode('utf-8', 'replace')
+            pos += NAME_LEN
+        elif not EVT_NAME <= evt <= EVT_OVERFLOW:
+            sys.stderr.write('bad event type %d at offset %d, stream truncated\n' % (evt, pos - 8))
+            break
+        yield evt, ident, aux, stamp, name
+
+
+class Converter:
+    def __init__(self, min_wait_us):
+        self.min_wait_us = min_wait_us
+        self.out = []
+        self.names = {NAME_THREAD: {}, NAME_MUTEX: {}, NAME_STAGE: {}}
+        self.base = None        # 第一个事件的时间戳
+        self.last_stamp = 0
+        self.wraps = 0
+        self.ts = 0.0
+        self.current = None     # 当前运行的线程编号
+        self.run_start = 0.0
+        self.isr_stack = []     # 嵌套中断 (IRQ号, 开始时间)
+        self.waits = {}         # 互斥锁编号 -> (线程编号, 开始时间, 当时的持有者)
+        self.holders = {}       # 互斥锁编号 -> [线程编号, 嵌套深度, 开始时间]
+        self.stages = {}        # (线程编号, 阶段编号) -> 开始时间
+        self.lost = 0
+
+    def name(self, kind, ident):
+        default = {NAME_THREAD: 'thread%d', NAME_MUTEX: 'mutex%d', NAME_STAGE: 'stage%d'}[kind] % ident
+        return self.names[kind].get(ident, default)
+
+    def thread_name(self, ident):
+        return '?' if ident is None else self.name(NAME_THREAD, ident)
+
+    def timestamp(self, stamp):
+        """展开32位微秒时间戳的回绕，返回相对第一个事件的微秒数"""
+        if self.base is None:
+            self.base = stamp
+            self.last_stamp = stamp
+        if stamp < self.last_stamp:
+            self.wraps += 1
+        self.last_stamp = stamp
+        return (stamp + (self.wraps << 32)) - self.base
+
+    def slice(self, pid, tid, name, start, end, args=None):
+        evt = {'ph': 'X', 'pid': pid, 'tid': tid, 'name': name, 'ts': start, 'dur': max(end - start, 0)}
+        if args:
+            evt['args'] = args
+        self.out.append(evt)
+
+    def feed(self, evt, ident, aux, stamp, name):
+        ts = self.ts = self.timestamp(stamp)
+        tid = self.current if self.current is not None else 0xFF
+
+        if evt == EVT_NAME:
+            self.names.setdefault(aux & 0xFF, {})[ident] = name
+        elif evt == EVT_SWITCH:
+            if self.current is not None:
+                self.slice(PID_SCHED, self.current, self.thread_name(self.current), self.run_start, ts)
+            self.current = ident
+            self.run_start = ts
+        elif evt == EVT_ISR_ENTER:
+            self.isr_stack.append((struct.unpack('<h', struct.pack('<H', aux))[0], ts))
+        elif evt == EVT_ISR_EXIT:
+            if self.isr_stack:
+                irq, start = self.isr_stack.pop()
+                self.slice(PID_SCHED, TID_ISR, 'SysTick' if irq == -1 else 'IRQ %d' % irq, start, ts)
+        elif evt == EVT_STAGE_BEGIN:
+            self.stages[(tid, ident)] = ts
+        elif evt == EVT_STAGE_END:
+            start = self.stages.pop((tid, ident), None)
+            if start is not None:
+                self.slice(PID_STAGES, tid, self.name(NAME_STAGE, ident), start, ts)
+        elif evt == EVT_MUTEX_WAIT:
+            holder = self.holders.get(ident)
+            self.waits[ident] = (tid, ts, None if holder is None else holder[0])
+        elif evt == EVT_MUTEX_TAKE:
+            wait = self.waits.pop(ident, None)
+            if wait is not None and ts - wait[1] >= self.min_wait_us:
+                self.slice(PID_STAGES, tid, 'wait ' + self.name(NAME_MUTEX, ident), wait[1], ts,
+                           {'holder': self.thread_name(wait[2])})
+            held = self.holders.get(ident)
+            if held is not None and held[0] == tid:
+                held[1] += 1
+            else:
+                self.holders[ident] = [tid, 1, ts]
+        elif evt == EVT_MUTEX_RELEASE:
+            held = self.holders.get(ident)
+            if held is not None and held[0] == tid:
+                held[1] -= 1
+                if held[1] == 0:
+                    self.slice(PID_LOCKS, ident, self.thread_name(tid), held[2], ts)
+                    del self.holders[ident]
+        elif evt == EVT_OVERFLOW:
+            self.lost += aux
+            self.out.append({'ph': 'i', 's': 'g', 'pid': PID_SCHED, 'tid': 0, 'ts': ts,
+                             'name': 'overflow: %d events lost' % aux})
+
+    def finish(self):
+        """关闭抓取结束时仍未结束的区间，并输出进程/轨道名称"""
+        ts = self.ts
+        if self.current is not None:
+            self.slice(PID_SCHED, self.current, self.thread_name(self.current), self.run_start, ts)
+        for ident, (tid, _, start) in self.holders.items():
+            self.slice(PID_LOCKS, ident, self.thread_name(tid), start, ts)
+
+        meta = []
+        for pid, pname in ((PID_SCHED, 'Scheduler'), (PID_STAGES, 'Stages'), (PID_LOCKS, 'Locks')):
+            meta.append({'ph': 'M', 'pid': pid, 'name': 'process_name', 'args': {'name': pname}})
+        for ident, tname in self.names[NAME_THREAD].items():
+            for pid in (PID_SCHED, PID_STAGES):
+                meta.append({'ph': 'M', 'pid': pid, 'tid': ident, 'name': 'thread_name', 'args': {'name': tname}})
+        for ident, mname in self.names[NAME_MUTEX].items():
+            meta.append({'ph': 'M', 'pid': PID_LOCKS, 'tid': ident, 'name': 'thread_name', 'args': {'name': mname}})
+        meta.append({'ph': 'M', 'pid': PID_SCHED, 'tid': TID_ISR, 'name': 'thread_name', 'args': {'name': 'ISR'}})
+        return {'traceEvents': meta + self.out, 'displayTimeUnit': 'ms'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert an RTT binary event trace to Chrome trace JSON')
+    parser.add_argument('capture', help='binary capture of RTT channel 0 ("-" for stdin)')
+    parser.add_argument('-o', '--output', default='-', help='output JSON file (default: stdout)')
+    parser.add_argument('--min-wait-us', type=float, default=1.0,
+                        help='hide mutex waits shorter than this (default: 1)')
+    args = parser.parse_args()
+
+    data = sys.stdin.buffer.read() if args.capture == '-' else open(args.capture, 'rb').read()
+    conv = Converter(args.min_wait_us)
+    count = 0
+    for evt in read_events(data):
+        conv.feed(*evt)
+        count += 1
+    result = conv.finish()
+
+    out = sys.stdout if args.output == '-' else open(args.output, 'w')
+    json.dump(result, out)
+    if out is not sys.stdout:
+        out.close()
+    sys.stderr.write('%d events, %.3f ms, %d lost\n' % (count, conv.ts / 1000.0, conv.lost))
+
+
+if __name__ == '__main__':
+    main()